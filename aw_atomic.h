@@ -7,13 +7,20 @@
 // 编译器后端选择逻辑
 // ============================================================================
 
-// 如果环境支持 C11 stdatomic，则不引入特定编译器的后端头文件
+// 后端由 aw_atomic_base.h 中的 AW_BACKEND 决定 (可用 AW_FORCE_BACKEND 强制指定)，
+// 各后端头文件只在被选中时生效；使用 C11 stdatomic 时不引入它们
 #ifndef AW_USE_STDATOMIC
     #include "aw_atomic_gcc.h"
     #include "aw_atomic_msvc.h"
     #include "aw_atomic_ac5.h"
 #endif
 
+#ifdef AW_ATOMIC_PROFILE
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <string.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -39,15 +46,19 @@ extern "C" {
         atomic_store_explicit(ptr, val, order)
 
     // 3. Exchange
-    #define aw_exchange(ptr, val, order) \
+    #define _aw_exchange_raw(ptr, val, order) \
         atomic_exchange_explicit(ptr, val, order)
 
     // 4. CAS
     // atomic_compare_exchange_strong 返回 bool，与 aw_cas 语义一致
     // 注意：stdatomic 要求 expected 参数为指针
-    #define aw_cas(ptr, expected_ptr, desired, success_order, fail_order) \
+    #define _aw_cas_raw(ptr, expected_ptr, desired, success_order, fail_order) \
         atomic_compare_exchange_strong_explicit(ptr, expected_ptr, desired, success_order, fail_order)
 
+    // 弱 CAS: 允许伪失败，只应在重试循环中使用
+    #define _aw_cas_weak_raw(ptr, expected_ptr, desired, success_order, fail_order) \
+        atomic_compare_exchange_weak_explicit(ptr, expected_ptr, desired, success_order, fail_order)
+
     // 5. Arithmetic
     #define aw_fetch_add(ptr, val, order) \
         atomic_fetch_add_explicit(ptr, val, order)
@@ -72,6 +83,13 @@ extern "C" {
     #define aw_signal_fence(order) \
         atomic_signal_fence(order)
 
+    // 8. Double-width (aw_atomic_dw_t)
+    #define aw_load_dw(ptr, order) \
+        atomic_load_explicit(ptr, order)
+
+    #define aw_cas_dw(ptr, expected_ptr, desired, success_order, fail_order) \
+        atomic_compare_exchange_strong_explicit(ptr, expected_ptr, desired, success_order, fail_order)
+
 #else
 
     // ========================================================================
@@ -93,9 +111,9 @@ extern "C" {
     #endif
 
     // --- 1. Load ---
-    #if defined(AW_COMPILER_GCC_LIKE) || defined(AW_COMPILER_AC5)
+    #if AW_BACKEND == AW_BACKEND_GCC_BUILTIN || AW_BACKEND == AW_BACKEND_GENERIC
         #define aw_load(ptr, order) _aw_impl_load(ptr, order)
-    #elif defined(AW_COMPILER_MSVC) 
+    #elif AW_BACKEND == AW_BACKEND_MSVC
         #define aw_load(ptr, order) \
             _Generic((0, *(ptr)), \
                 char:               _aw_msvc_load_8(_AW_CAST_8(ptr), order), \
@@ -115,9 +133,9 @@ extern "C" {
     #endif
 
     // --- 2. Store ---
-    #if defined(AW_COMPILER_GCC_LIKE) || defined(AW_COMPILER_AC5)
+    #if AW_BACKEND == AW_BACKEND_GCC_BUILTIN || AW_BACKEND == AW_BACKEND_GENERIC
         #define aw_store(ptr, val, order) _aw_impl_store(ptr, val, order)
-    #elif defined(AW_COMPILER_MSVC)
+    #elif AW_BACKEND == AW_BACKEND_MSVC
         #define aw_store(ptr, val, order) \
             _Generic((0, *(ptr)), \
                 char:               _aw_msvc_store_8(_AW_CAST_8(ptr), (char)(val), order), \
@@ -137,10 +155,10 @@ extern "C" {
     #endif
 
     // --- 3. Exchange ---
-    #if defined(AW_COMPILER_GCC_LIKE) || defined(AW_COMPILER_AC5)
-        #define aw_exchange(ptr, val, order) _aw_impl_exchange(ptr, val, order)
-    #elif defined(AW_COMPILER_MSVC)
-        #define aw_exchange(ptr, val, order) \
+    #if AW_BACKEND == AW_BACKEND_GCC_BUILTIN || AW_BACKEND == AW_BACKEND_GENERIC
+        #define _aw_exchange_raw(ptr, val, order) _aw_impl_exchange(ptr, val, order)
+    #elif AW_BACKEND == AW_BACKEND_MSVC
+        #define _aw_exchange_raw(ptr, val, order) \
             _Generic((0, *(ptr)), \
                 char:               _aw_msvc_exchange_8(_AW_CAST_8(ptr), (char)(val), order), \
                 signed char:        _aw_msvc_exchange_8(_AW_CAST_8(ptr), (char)(val), order), \
@@ -159,11 +177,11 @@ extern "C" {
     #endif
 
     // --- 4. CAS ---
-    #if defined(AW_COMPILER_GCC_LIKE) || defined(AW_COMPILER_AC5)
-        #define aw_cas(ptr, expected_ptr, desired, success_order, fail_order) \
+    #if AW_BACKEND == AW_BACKEND_GCC_BUILTIN || AW_BACKEND == AW_BACKEND_GENERIC
+        #define _aw_cas_raw(ptr, expected_ptr, desired, success_order, fail_order) \
             _aw_impl_cas(ptr, expected_ptr, desired, success_order, fail_order)
-    #elif defined(AW_COMPILER_MSVC)
-        #define aw_cas(ptr, expected_ptr, desired, success_order, fail_order) \
+    #elif AW_BACKEND == AW_BACKEND_MSVC
+        #define _aw_cas_raw(ptr, expected_ptr, desired, success_order, fail_order) \
             _Generic((0, *(ptr)), \
                 char:               _aw_msvc_cas_8(_AW_CAST_8(ptr), (char*)(expected_ptr), (char)(desired), success_order, fail_order), \
                 signed char:        _aw_msvc_cas_8(_AW_CAST_8(ptr), (char*)(expected_ptr), (char)(desired), success_order, fail_order), \
@@ -181,11 +199,22 @@ extern "C" {
             )
     #endif
 
+    // 弱 CAS: 允许伪失败，只应在重试循环中使用。
+    // LL/SC 架构 (AArch64 / RISC-V / ARMv7) 上省去强 CAS 内部的重试循环;
+    // x86 的 lock cmpxchg 与 AC5 的 __sync 没有伪失败，直接复用强 CAS
+    #if AW_BACKEND == AW_BACKEND_GCC_BUILTIN || AW_BACKEND == AW_BACKEND_GENERIC
+        #define _aw_cas_weak_raw(ptr, expected_ptr, desired, success_order, fail_order) \
+            _aw_impl_cas_weak(ptr, expected_ptr, desired, success_order, fail_order)
+    #elif AW_BACKEND == AW_BACKEND_MSVC
+        #define _aw_cas_weak_raw(ptr, expected_ptr, desired, success_order, fail_order) \
+            _aw_cas_raw(ptr, expected_ptr, desired, success_order, fail_order)
+    #endif
+
     // --- 5. Arithmetic ---
-    #if defined(AW_COMPILER_GCC_LIKE) || defined(AW_COMPILER_AC5)
+    #if AW_BACKEND == AW_BACKEND_GCC_BUILTIN || AW_BACKEND == AW_BACKEND_GENERIC
         #define aw_fetch_add(ptr, val, order) _aw_impl_fetch_add(ptr, val, order)
         #define aw_fetch_sub(ptr, val, order) _aw_impl_fetch_sub(ptr, val, order)
-    #elif defined(AW_COMPILER_MSVC)
+    #elif AW_BACKEND == AW_BACKEND_MSVC
         #define aw_fetch_add(ptr, val, order) \
             _Generic((0, *(ptr)), \
                 char:               _aw_msvc_fetch_add_8(_AW_CAST_8(ptr), (char)(val), order), \
@@ -204,11 +233,11 @@ extern "C" {
     #endif
 
     // --- 6. Bitwise ---
-    #if defined(AW_COMPILER_GCC_LIKE) || defined(AW_COMPILER_AC5)
+    #if AW_BACKEND == AW_BACKEND_GCC_BUILTIN || AW_BACKEND == AW_BACKEND_GENERIC
         #define aw_fetch_and(ptr, val, order) _aw_impl_fetch_and(ptr, val, order)
         #define aw_fetch_or(ptr, val, order)  _aw_impl_fetch_or(ptr, val, order)
         #define aw_fetch_xor(ptr, val, order) _aw_impl_fetch_xor(ptr, val, order)
-    #elif defined(AW_COMPILER_MSVC)
+    #elif AW_BACKEND == AW_BACKEND_MSVC
         #define aw_fetch_and(ptr, val, order) \
             _Generic((0, *(ptr)), \
                 char:               _aw_msvc_fetch_and_8(_AW_CAST_8(ptr), (char)(val), order), \
@@ -254,10 +283,10 @@ extern "C" {
     #endif
 
     // --- 7. Fences ---
-    #if defined(AW_COMPILER_GCC_LIKE) || defined(AW_COMPILER_AC5)
+    #if AW_BACKEND == AW_BACKEND_GCC_BUILTIN || AW_BACKEND == AW_BACKEND_GENERIC
         #define aw_thread_fence(order) _aw_impl_thread_fence(order)
         #define aw_signal_fence(order) _aw_impl_signal_fence(order)
-    #elif defined(AW_COMPILER_MSVC)
+    #elif AW_BACKEND == AW_BACKEND_MSVC
         #define aw_thread_fence(order) \
             do { \
                 if ((order) == AW_MO_SEQ_CST) MemoryBarrier(); \
@@ -267,8 +296,257 @@ extern "C" {
         #define aw_signal_fence(order) _ReadWriteBarrier()
     #endif
 
+    // --- 8. Double-width ---
+    // __sync 通用回退后端 (AC5) 没有可用的双字 CAS，不提供该接口 (以 AW_HAS_DW_CAS 判断)
+    #if AW_BACKEND == AW_BACKEND_GCC_BUILTIN
+        #define aw_load_dw(ptr, order) _aw_impl_load_dw(ptr, order)
+        #define aw_cas_dw(ptr, expected_ptr, desired, success_order, fail_order) \
+            _aw_impl_cas_dw(ptr, expected_ptr, desired, success_order, fail_order)
+    #elif AW_BACKEND == AW_BACKEND_MSVC
+        #define aw_load_dw(ptr, order) _aw_msvc_load_dw(ptr, order)
+        #define aw_cas_dw(ptr, expected_ptr, desired, success_order, fail_order) \
+            _aw_msvc_cas_dw(ptr, expected_ptr, desired, success_order, fail_order)
+    #endif
+
 #endif // AW_USE_STDATOMIC
 
+// ============================================================================
+// 竞争分析模式 (AW_ATOMIC_PROFILE)
+// ============================================================================
+// 默认 aw_exchange / aw_cas / aw_cas_weak 直接映射到后端实现，没有任何额外开销;
+// 定义 AW_ATOMIC_PROFILE 后按调用点 (__FILE__/__LINE__) 统计次数与 CAS 失败次数，
+// 详见 aw_profile.h
+// 库内直接调用 aw_cpu_pause() 的等待循环用 AW_PROFILE_SPIN(pauses) 记录一轮等待
+// 及其中的 pause 次数，未启用时为空操作
+#ifdef AW_ATOMIC_PROFILE
+    #include "aw_profile.h"
+
+    #define AW_PROFILE_SPIN(pauses) _aw_prof_spin((unsigned int)(pauses), __FILE__, __LINE__)
+
+    #define aw_exchange(ptr, val, order) \
+        (_aw_prof_exchange(__FILE__, __LINE__), _aw_exchange_raw(ptr, val, order))
+    #define aw_cas(ptr, expected_ptr, desired, success_order, fail_order) \
+        _aw_prof_cas(_aw_cas_raw(ptr, expected_ptr, desired, success_order, fail_order), __FILE__, __LINE__)
+    #define aw_cas_weak(ptr, expected_ptr, desired, success_order, fail_order) \
+        _aw_prof_cas(_aw_cas_weak_raw(ptr, expected_ptr, desired, success_order, fail_order), __FILE__, __LINE__)
+#else
+    #define AW_PROFILE_SPIN(pauses) ((void)0)
+
+    #define aw_exchange(ptr, val, order) \
+        _aw_exchange_raw(ptr, val, order)
+    #define aw_cas(ptr, expected_ptr, desired, success_order, fail_order) \
+        _aw_cas_raw(ptr, expected_ptr, desired, success_order, fail_order)
+    #define aw_cas_weak(ptr, expected_ptr, desired, success_order, fail_order) \
+        _aw_cas_weak_raw(ptr, expected_ptr, desired, success_order, fail_order)
+#endif
+
+// ============================================================================
+// 通用读-改-写循环
+// ============================================================================
+// aw_fetch_update(ptr, old_var, new_expr, order)
+//   以 Relaxed 读取初值到 old_var，随后以弱 CAS 循环把 *ptr 从 old_var 更新为
+//   new_expr (每轮基于最新的 old_var 重新求值)。结束后 old_var 为更新前的值。
+//   new_expr 可能被求值多次，不应带有副作用。
+//
+//   unsigned int old;
+//   aw_fetch_update(&flags, old, (old | FLAG_A) & ~FLAG_B, AW_MO_ACQ_REL);
+#define aw_fetch_update(ptr, old_var, new_expr, order) \
+    do { \
+        (old_var) = aw_load(ptr, AW_MO_RELAXED); \
+        while (!aw_cas_weak(ptr, &(old_var), (new_expr), order, AW_MO_RELAXED)) { \
+        } \
+    } while (0)
+
+// ============================================================================
+// 原子最大/最小值
+// ============================================================================
+// aw_fetch_max(ptr, val, order) / aw_fetch_min(ptr, val, order)
+//   *ptr = max(*ptr, val) / min(*ptr, val)，返回操作前的旧值。
+//   快速路径: 当前值已经不小于 (不大于) val 时直接返回，不发起 RMW，
+//   高水位线等基本只增不减的场景下绝大多数调用只有一次读取。
+//   仅支持整数类型。
+
+// RMW 内存序中 "读" 的部分，用于快速路径的读取与 CAS 失败序
+AW_INLINE aw_memory_order _aw_mo_load_part(aw_memory_order order) {
+    if (order == AW_MO_RELEASE) {
+        return AW_MO_RELAXED;
+    }
+    if (order == AW_MO_ACQ_REL) {
+        return AW_MO_ACQUIRE;
+    }
+    return order;
+}
+
+#if defined(AW_COMPILER_GCC_LIKE) || defined(AW_COMPILER_AC5)
+
+    // Clang 提供原生 __atomic_fetch_max/min (AArch64 LSE 上为 ldsmax/ldumax 等)
+    #if defined(__clang__) && defined(__has_builtin)
+        #if __has_builtin(__atomic_fetch_max) && __has_builtin(__atomic_fetch_min) && \
+            AW_BACKEND == AW_BACKEND_GCC_BUILTIN
+            #define _AW_HAS_NATIVE_FETCH_MINMAX
+        #endif
+    #endif
+
+    #if defined(_AW_HAS_NATIVE_FETCH_MINMAX)
+        #define _aw_fetch_minmax(ptr, val, order, cmp, native) \
+            __extension__ ({ \
+                __typeof__(aw_load(ptr, AW_MO_RELAXED)) _aw_cur = \
+                    aw_load(ptr, _aw_mo_load_part(order)); \
+                __typeof__(_aw_cur) _aw_val = (val); \
+                if (_aw_val cmp _aw_cur) { \
+                    _aw_cur = native(ptr, _aw_val, order); \
+                } \
+                _aw_cur; \
+            })
+    #else
+        #define _aw_fetch_minmax(ptr, val, order, cmp, native) \
+            __extension__ ({ \
+                __typeof__(aw_load(ptr, AW_MO_RELAXED)) _aw_cur = \
+                    aw_load(ptr, _aw_mo_load_part(order)); \
+                __typeof__(_aw_cur) _aw_val = (val); \
+                while (_aw_val cmp _aw_cur && \
+                       !aw_cas_weak(ptr, &_aw_cur, _aw_val, order, _aw_mo_load_part(order))) { \
+                } \
+                _aw_cur; \
+            })
+    #endif
+
+    #define aw_fetch_max(ptr, val, order) _aw_fetch_minmax(ptr, val, order, >, __atomic_fetch_max)
+    #define aw_fetch_min(ptr, val, order) _aw_fetch_minmax(ptr, val, order, <, __atomic_fetch_min)
+
+#else
+
+    // 无 typeof / 语句表达式的编译器 (MSVC): 按类型生成函数，再用 _Generic 分发
+    #define _AW_DEF_FETCH_MINMAX(suffix, type) \
+        AW_INLINE type _aw_fetch_max_##suffix(aw_atomic_t(type)* ptr, type val, aw_memory_order order) { \
+            type cur = (type)aw_load(ptr, _aw_mo_load_part(order)); \
+            while (val > cur && !aw_cas_weak(ptr, &cur, val, order, _aw_mo_load_part(order))) { \
+            } \
+            return cur; \
+        } \
+        AW_INLINE type _aw_fetch_min_##suffix(aw_atomic_t(type)* ptr, type val, aw_memory_order order) { \
+            type cur = (type)aw_load(ptr, _aw_mo_load_part(order)); \
+            while (val < cur && !aw_cas_weak(ptr, &cur, val, order, _aw_mo_load_part(order))) { \
+            } \
+            return cur; \
+        }
+
+    _AW_DEF_FETCH_MINMAX(int, int)
+    _AW_DEF_FETCH_MINMAX(uint, unsigned int)
+    _AW_DEF_FETCH_MINMAX(long, long)
+    _AW_DEF_FETCH_MINMAX(ulong, unsigned long)
+    _AW_DEF_FETCH_MINMAX(llong, long long)
+    _AW_DEF_FETCH_MINMAX(ullong, unsigned long long)
+
+    #define _aw_fetch_minmax(op, ptr, val, order) \
+        _Generic((0, *(ptr)), \
+            int:                _aw_fetch_##op##_int((aw_atomic_t(int)*)(ptr), (int)(val), order), \
+            unsigned int:       _aw_fetch_##op##_uint((aw_atomic_t(unsigned int)*)(ptr), (unsigned int)(val), order), \
+            long:               _aw_fetch_##op##_long((aw_atomic_t(long)*)(ptr), (long)(val), order), \
+            unsigned long:      _aw_fetch_##op##_ulong((aw_atomic_t(unsigned long)*)(ptr), (unsigned long)(val), order), \
+            long long:          _aw_fetch_##op##_llong((aw_atomic_t(long long)*)(ptr), (long long)(val), order), \
+            unsigned long long: _aw_fetch_##op##_ullong((aw_atomic_t(unsigned long long)*)(ptr), (unsigned long long)(val), order) \
+        )
+
+    #define aw_fetch_max(ptr, val, order) _aw_fetch_minmax(max, ptr, val, order)
+    #define aw_fetch_min(ptr, val, order) _aw_fetch_minmax(min, ptr, val, order)
+
+#endif
+
+// ============================================================================
+// 单比特测试并修改
+// ============================================================================
+// aw_bit_test_and_set / reset / complement(ptr, bit, order)
+//   原子地置位 / 清除 / 翻转 *ptr 的第 bit 位，返回该位原来的值 (bool)。
+//   写成 "fetch_op(mask) & mask" 的形式，GCC 12+ 在 x86 上会将其识别为
+//   lock bts / btr / btc (不再需要 CAS 循环取回整个旧值)，AArch64 LSE 上为
+//   ldset / ldclr / ldeor。仅支持整数类型，bit 必须小于 *ptr 的位宽。
+//   ptr 与 bit 各只求值一次；掩码在与 *ptr 等宽的无符号数上移位再转换为
+//   *ptr 的类型，bit 为符号位 (如 int 的第 31 位) 时也没有未定义行为。
+// 移位宽度必须与字宽一致，否则 GCC 认不出 bts 模式而退化为 CAS 循环
+// (清除位的反掩码同理，须先在无符号数上取反再转换)
+#define _AW_BIT_MASK(type, bit) \
+    ((type)(sizeof(type) > sizeof(unsigned int) ? (1ULL << (bit)) : (1U << (bit))))
+#define _AW_BIT_CLEAR_MASK(type, bit) \
+    ((type)(sizeof(type) > sizeof(unsigned int) ? ~(1ULL << (bit)) : ~(1U << (bit))))
+
+#if !defined(__cplusplus) && \
+    ((defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L) || defined(AW_COMPILER_MSVC))
+
+    // 按类型生成函数，再用 _Generic 分发 (与 aw_fetch_max/min 的 MSVC 实现相同)
+    #define _AW_DEF_BIT_OPS(suffix, type) \
+        AW_INLINE bool _aw_bit_test_and_set_##suffix(aw_atomic_t(type)* ptr, unsigned int bit, aw_memory_order order) { \
+            type mask = _AW_BIT_MASK(type, bit); \
+            return (aw_fetch_or(ptr, mask, order) & mask) != 0; \
+        } \
+        AW_INLINE bool _aw_bit_test_and_reset_##suffix(aw_atomic_t(type)* ptr, unsigned int bit, aw_memory_order order) { \
+            type mask = _AW_BIT_MASK(type, bit); \
+            return (aw_fetch_and(ptr, _AW_BIT_CLEAR_MASK(type, bit), order) & mask) != 0; \
+        } \
+        AW_INLINE bool _aw_bit_test_and_complement_##suffix(aw_atomic_t(type)* ptr, unsigned int bit, aw_memory_order order) { \
+            type mask = _AW_BIT_MASK(type, bit); \
+            return (aw_fetch_xor(ptr, mask, order) & mask) != 0; \
+        }
+
+    _AW_DEF_BIT_OPS(int, int)
+    _AW_DEF_BIT_OPS(uint, unsigned int)
+    _AW_DEF_BIT_OPS(long, long)
+    _AW_DEF_BIT_OPS(ulong, unsigned long)
+    _AW_DEF_BIT_OPS(llong, long long)
+    _AW_DEF_BIT_OPS(ullong, unsigned long long)
+
+    #define _aw_bit_op(op, ptr, bit, order) \
+        _Generic(+*(ptr), \
+            int:                _aw_bit_test_and_##op##_int, \
+            unsigned int:       _aw_bit_test_and_##op##_uint, \
+            long:               _aw_bit_test_and_##op##_long, \
+            unsigned long:      _aw_bit_test_and_##op##_ulong, \
+            long long:          _aw_bit_test_and_##op##_llong, \
+            unsigned long long: _aw_bit_test_and_##op##_ullong \
+        )(ptr, (unsigned int)(bit), order)
+
+    #define aw_bit_test_and_set(ptr, bit, order)        _aw_bit_op(set, ptr, bit, order)
+    #define aw_bit_test_and_reset(ptr, bit, order)      _aw_bit_op(reset, ptr, bit, order)
+    #define aw_bit_test_and_complement(ptr, bit, order) _aw_bit_op(complement, ptr, bit, order)
+
+#else
+
+    // 没有 _Generic 的 GNU C (gnu99 / AC5 / C++): 语句表达式中先求值到局部变量
+    #define _aw_bit_op(fetch_op, ptr, bit, order, arg_mask) \
+        __extension__ ({ \
+            __typeof__(ptr) _aw_bp = (ptr); \
+            unsigned int _aw_bb = (unsigned int)(bit); \
+            __typeof__(aw_load(_aw_bp, AW_MO_RELAXED)) _aw_bm = \
+                _AW_BIT_MASK(__typeof__(_aw_bm), _aw_bb); \
+            (fetch_op(_aw_bp, arg_mask(__typeof__(_aw_bm), _aw_bb), order) & _aw_bm) != 0; \
+        })
+
+    #define aw_bit_test_and_set(ptr, bit, order)        _aw_bit_op(aw_fetch_or, ptr, bit, order, _AW_BIT_MASK)
+    #define aw_bit_test_and_reset(ptr, bit, order)      _aw_bit_op(aw_fetch_and, ptr, bit, order, _AW_BIT_CLEAR_MASK)
+    #define aw_bit_test_and_complement(ptr, bit, order) _aw_bit_op(aw_fetch_xor, ptr, bit, order, _AW_BIT_MASK)
+
+#endif
+
+// ============================================================================
+// 双字 CAS 能力检测
+// ============================================================================
+// AW_HAS_DW_CAS   : aw_load_dw / aw_cas_dw 可用
+// AW_DW_LOCK_FREE : 1 表示由 CPU 双字 CAS 指令直接实现;
+//                   0 表示编译期无法确认目标 CPU 具备该指令 (如未开启 -mcx16 的 x86-64)，
+//                   由运行时库 (libatomic) 选择实现，CPU 不支持时退化为加锁实现，
+//                   仍然正确但不再无锁
+#if defined(aw_cas_dw)
+    #define AW_HAS_DW_CAS
+    #if defined(AW_COMPILER_MSVC)
+        #define AW_DW_LOCK_FREE 1
+    #elif (AW_DW_SIZE == 16 && (defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) || defined(__aarch64__))) || \
+          (AW_DW_SIZE == 8 && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8))
+        #define AW_DW_LOCK_FREE 1
+    #else
+        #define AW_DW_LOCK_FREE 0
+    #endif
+#endif
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -3,10 +3,12 @@
 
 #include "aw_atomic_base.h"
 
-#ifdef AW_COMPILER_AC5
+#if AW_BACKEND == AW_BACKEND_GENERIC
 
 // AC5 doesn't support C11 _Generic, but its __sync_* intrinsics are overloaded.
 // For Load/Store, we use volatile access + barriers.
+// __sync 内建函数总是全屏障，不使用内存序参数；各宏自行以 (void) 求值，
+// 调用方的 order / succ / fail 形参在本后端下不会触发 -Wunused-parameter。
 
 // AC5 Barrier Helpers
 AW_INLINE void _aw_ac5_barrier(aw_memory_order order) {
@@ -37,47 +39,66 @@ AW_INLINE void _aw_ac5_barrier(aw_memory_order order) {
 // 3. Exchange
 // __sync_lock_test_and_set is actually an acquire barrier exchange usually, 
 // but __sync_val_compare_and_swap loop is safer for full exchange semantics in legacy mode.
+// val 只求值一次: 调用方可能传入带副作用的表达式 (如分配新节点)
 #define _aw_impl_exchange(ptr, val, order) \
     ({ \
         __typeof__(*(ptr)) _old; \
+        __typeof__(*(ptr)) _new = (val); \
+        (void)(order); \
         do { \
             _old = *(volatile __typeof__(*(ptr))*)(ptr); \
-        } while (__sync_val_compare_and_swap(ptr, _old, val) != _old); \
+        } while (__sync_val_compare_and_swap(ptr, _old, _new) != _old); \
         _old; \
     })
 
 // 4. CAS
 // __sync_bool_compare_and_swap returns bool, matches our need.
 // AC5 sync builtins are full barriers (SeqCst).
+// legacy 模式下 aw_atomic_ptr_t 为 volatile void*，写回 *exp 时需去掉 volatile。
 #define _aw_impl_cas(ptr, exp, des, succ, fail) \
     ({ \
         bool _ret = false; \
         __typeof__(*(ptr)) _old_val = *(exp); \
-        __typeof__(*(ptr)) _prev_val = __sync_val_compare_and_swap(ptr, _old_val, des); \
+        __typeof__(*(ptr)) _prev_val; \
+        (void)(succ); \
+        (void)(fail); \
+        _prev_val = __sync_val_compare_and_swap(ptr, _old_val, des); \
         if (_prev_val == _old_val) { \
             _ret = true; \
         } else { \
-            *(exp) = _prev_val; \
+            *(exp) = (__typeof__(*(exp)))_prev_val; \
             _ret = false; \
         } \
         _ret; \
     })
 
+// __sync 没有弱 CAS 形式，直接复用强 CAS
+#define _aw_impl_cas_weak(ptr, exp, des, succ, fail) \
+    _aw_impl_cas(ptr, exp, des, succ, fail)
+
 // 5. Fetch Ops
 // AC5 __sync intrinsics are overloaded for 1, 2, 4, 8 byte integers.
-#define _aw_impl_fetch_add(ptr, val, order) __sync_fetch_and_add(ptr, val)
-#define _aw_impl_fetch_sub(ptr, val, order) __sync_fetch_and_sub(ptr, val)
-#define _aw_impl_fetch_and(ptr, val, order) __sync_fetch_and_and(ptr, val)
-#define _aw_impl_fetch_or(ptr, val, order)  __sync_fetch_and_or(ptr, val)
-#define _aw_impl_fetch_xor(ptr, val, order) __sync_fetch_and_xor(ptr, val)
+#define _aw_impl_fetch_add(ptr, val, order) ((void)(order), __sync_fetch_and_add(ptr, val))
+#define _aw_impl_fetch_sub(ptr, val, order) ((void)(order), __sync_fetch_and_sub(ptr, val))
+#define _aw_impl_fetch_and(ptr, val, order) ((void)(order), __sync_fetch_and_and(ptr, val))
+#define _aw_impl_fetch_or(ptr, val, order)  ((void)(order), __sync_fetch_and_or(ptr, val))
+#define _aw_impl_fetch_xor(ptr, val, order) ((void)(order), __sync_fetch_and_xor(ptr, val))
 
 // 6. Fences
 #define _aw_impl_thread_fence(order) \
-    if (order != AW_MO_RELAXED) __sync_synchronize()
+    do { \
+        if ((order) != AW_MO_RELAXED) __sync_synchronize(); \
+    } while(0)
 
+// __schedule_barrier() 是 armcc 内建函数，GCC/Clang 使用空 asm 编译器屏障
+#if defined(__CC_ARM)
+#define _aw_impl_signal_fence(order) \
+    do { (void)(order); __schedule_barrier(); } while(0)
+#else
 #define _aw_impl_signal_fence(order) \
-    __schedule_barrier()
+    do { (void)(order); __asm__ __volatile__("" ::: "memory"); } while(0)
+#endif
 
-#endif // AW_COMPILER_AC5
+#endif // AW_BACKEND_GENERIC
 
 #endif // AW_BACKEND_AC5_H
\ No newline at end of file
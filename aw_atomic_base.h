@@ -10,10 +10,54 @@
 // 1. C 标准与编译器检测
 // ============================================================================
 
-// 检测 C11 及以上版本的原子操作支持
-// 如果定义了 __STDC_NO_ATOMICS__, 后续将直接使用标准库接口
-#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
-    #define AW_USE_STDATOMIC
+// 后端编号，AW_BACKEND 为实际选用的后端
+#define AW_BACKEND_STDATOMIC   1    // C11 <stdatomic.h>
+#define AW_BACKEND_GCC_BUILTIN 2    // GCC/Clang/AC6 __atomic 内置函数 (aw_atomic_gcc.h)
+#define AW_BACKEND_GENERIC     3    // __sync 内置函数的通用回退实现 (aw_atomic_ac5.h)
+#define AW_BACKEND_MSVC        4    // MSVC _Interlocked 系列 (aw_atomic_msvc.h)
+
+/*
+ * 编译期强制指定后端，用于对比不同实现路径 (默认按下方规则自动选择):
+ *   -DAW_FORCE_BACKEND=AW_BACKEND_STDATOMIC     需要 C11 原子支持
+ *   -DAW_FORCE_BACKEND=AW_BACKEND_GCC_BUILTIN   需要 GCC-like 编译器 (在 C11 下也绕过 stdatomic)
+ *   -DAW_FORCE_BACKEND=AW_BACKEND_GENERIC       需要支持 __sync 与语句表达式的编译器 (GCC-like / AC5)
+ * 同一程序的所有翻译单元必须使用相同的后端 (原子类型的声明方式不同)。
+ */
+#if defined(AW_FORCE_BACKEND)
+    #if AW_FORCE_BACKEND == AW_BACKEND_STDATOMIC
+        #if !defined(__STDC_VERSION__) || __STDC_VERSION__ < 201112L || defined(__STDC_NO_ATOMICS__)
+            #error "aw_atomics: AW_FORCE_BACKEND=AW_BACKEND_STDATOMIC requires C11 atomics"
+        #endif
+        #define AW_USE_STDATOMIC
+    #elif AW_FORCE_BACKEND == AW_BACKEND_GCC_BUILTIN
+        #if !defined(AW_COMPILER_GCC_LIKE)
+            #error "aw_atomics: AW_FORCE_BACKEND=AW_BACKEND_GCC_BUILTIN requires a GCC-like compiler"
+        #endif
+    #elif AW_FORCE_BACKEND == AW_BACKEND_GENERIC
+        #if !defined(AW_COMPILER_GCC_LIKE) && !defined(AW_COMPILER_AC5)
+            #error "aw_atomics: AW_FORCE_BACKEND=AW_BACKEND_GENERIC requires GCC-like or AC5 compiler"
+        #endif
+    #elif AW_FORCE_BACKEND == AW_BACKEND_MSVC
+        #if !defined(AW_COMPILER_MSVC)
+            #error "aw_atomics: AW_FORCE_BACKEND=AW_BACKEND_MSVC requires MSVC"
+        #endif
+    #else
+        #error "aw_atomics: unknown AW_FORCE_BACKEND"
+    #endif
+    #define AW_BACKEND AW_FORCE_BACKEND
+#else
+    // 检测 C11 及以上版本的原子操作支持
+    // 如果定义了 __STDC_NO_ATOMICS__, 后续将直接使用标准库接口
+    #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+        #define AW_USE_STDATOMIC
+        #define AW_BACKEND AW_BACKEND_STDATOMIC
+    #elif defined(AW_COMPILER_MSVC)
+        #define AW_BACKEND AW_BACKEND_MSVC
+    #elif defined(AW_COMPILER_GCC_LIKE)
+        #define AW_BACKEND AW_BACKEND_GCC_BUILTIN
+    #elif defined(AW_COMPILER_AC5)
+        #define AW_BACKEND AW_BACKEND_GENERIC
+    #endif
 #endif
 
 /**
@@ -92,7 +136,10 @@
     #define AW_ATOMIC_VAR_INIT(val) (val)
 #endif
 
-// 常用原子类型别名
+// 常用原子类型别名 (8/16 位类型仅支持读写、交换、CAS 与 Fetch-and-Op，
+// 不支持 aw_fetch_max/min 与位操作)
+typedef aw_atomic_t(unsigned char)      aw_atomic_uchar_t;
+typedef aw_atomic_t(unsigned short)     aw_atomic_ushort_t;
 typedef aw_atomic_t(int)                aw_atomic_int_t;
 typedef aw_atomic_t(unsigned int)       aw_atomic_uint_t;
 typedef aw_atomic_t(long)               aw_atomic_long_t;
@@ -102,11 +149,121 @@ typedef aw_atomic_t(unsigned long long) aw_atomic_ullong_t;
 typedef aw_atomic_t(void*)              aw_atomic_ptr_t;
 typedef aw_atomic_t(size_t)             aw_atomic_size_t;
 
+/*
+ * 双字类型 (两个机器字，64 位平台上为 128 位)，配合 aw_cas_dw 使用，
+ * 用于 "指针 + 标签" / "指针 + 计数" 这类需要整体原子更新以避免 ABA 的场景。
+ * 必须按自身大小对齐，CPU 的双字 CAS 指令 (cmpxchg16b / CASP) 要求如此。
+ */
+#if UINTPTR_MAX > 0xFFFFFFFFu
+    #define AW_DW_SIZE 16
+#else
+    #define AW_DW_SIZE 8
+#endif
+
+#if defined(AW_COMPILER_MSVC) || defined(AW_COMPILER_GCC_LIKE) || defined(AW_COMPILER_AC5)
+    typedef struct __port_align(AW_DW_SIZE) {
+        uintptr_t lo;
+        uintptr_t hi;
+    } aw_dw_t;
+#else
+    typedef struct {
+        _Alignas(AW_DW_SIZE) uintptr_t lo;
+        uintptr_t hi;
+    } aw_dw_t;
+#endif
+
+typedef aw_atomic_t(aw_dw_t)            aw_atomic_dw_t;
+
+// ============================================================================
+// 4. 缓存行对齐与填充
+// ============================================================================
+
+/*
+ * 缓存行大小 (字节)。可在编译选项中以 -DAW_CACHELINE_SIZE=n 覆盖，
+ * 必须为整数字面量。
+ * - Apple Silicon / POWER: 128
+ * - s390x: 256
+ * - 其他 (x86, 通用 ARM, RISC-V): 64
+ */
+#ifndef AW_CACHELINE_SIZE
+    #if (defined(__APPLE__) && defined(__aarch64__)) || defined(__powerpc64__) || defined(__ppc64__)
+        #define AW_CACHELINE_SIZE 128
+    #elif defined(__s390x__)
+        #define AW_CACHELINE_SIZE 256
+    #else
+        #define AW_CACHELINE_SIZE 64
+    #endif
+#endif
+
+// 按缓存行对齐的结构体修饰，用法: typedef struct AW_CACHELINE_ALIGN { ... } foo_t;
+#define AW_CACHELINE_ALIGN __port_align(AW_CACHELINE_SIZE)
+
+/*
+ * 独占整条缓存行的原子类型，相邻的计数器不会再伪共享。
+ * 通过 .value 成员访问，例如:
+ *   aw_padded_atomic_ullong_t hits;
+ *   aw_inc_rlx(&hits.value);
+ * 注意: 动态分配时需使用按缓存行对齐的分配函数 (如 aligned_alloc)，
+ * 普通 malloc 只保证 16 字节对齐，此时只有尺寸 (填充) 生效。
+ */
+#define _AW_PADDED_ATOMIC(name, atomic_type) \
+    typedef struct AW_CACHELINE_ALIGN { \
+        atomic_type value; \
+        char        _pad[AW_CACHELINE_SIZE - sizeof(atomic_type)]; \
+    } name
+
+_AW_PADDED_ATOMIC(aw_padded_atomic_uchar_t,  aw_atomic_uchar_t);
+_AW_PADDED_ATOMIC(aw_padded_atomic_ushort_t, aw_atomic_ushort_t);
+_AW_PADDED_ATOMIC(aw_padded_atomic_int_t,    aw_atomic_int_t);
+_AW_PADDED_ATOMIC(aw_padded_atomic_uint_t,   aw_atomic_uint_t);
+_AW_PADDED_ATOMIC(aw_padded_atomic_long_t,   aw_atomic_long_t);
+_AW_PADDED_ATOMIC(aw_padded_atomic_ulong_t,  aw_atomic_ulong_t);
+_AW_PADDED_ATOMIC(aw_padded_atomic_llong_t,  aw_atomic_llong_t);
+_AW_PADDED_ATOMIC(aw_padded_atomic_ullong_t, aw_atomic_ullong_t);
+_AW_PADDED_ATOMIC(aw_padded_atomic_ptr_t,    aw_atomic_ptr_t);
+_AW_PADDED_ATOMIC(aw_padded_atomic_size_t,   aw_atomic_size_t);
+
 
 // ============================================================================
-// 4. 辅助宏
+// 5. 辅助宏
 // ============================================================================
 #define AW_INLINE static inline
 
+// 由结构体成员指针反推结构体指针 (用于侵入式数据结构)
+#define AW_CONTAINER_OF(ptr, type, member) \
+    ((type*)((char*)(ptr) - offsetof(type, member)))
+
+
+/*
+ * CPU 自旋提示指令，用于忙等循环体内:
+ * - x86: pause，降低同核超线程的资源占用，并避免退出循环时的内存序冲突流水线清空
+ * - ARM: yield
+ * - RISC-V: pause (Zihintpause，旧核上按 fence 编码执行为空操作)
+ * - 其他: 退化为编译器屏障，保证循环内的读取不会被优化掉
+ */
+#if defined(AW_COMPILER_MSVC)
+    #if defined(AW_ARCH_X86)
+        #define aw_cpu_pause() _mm_pause()
+    #elif defined(AW_ARCH_ARM)
+        #define aw_cpu_pause() __yield()
+    #else
+        #define aw_cpu_pause() _ReadWriteBarrier()
+    #endif
+#elif defined(AW_COMPILER_AC5)
+    #define aw_cpu_pause() __yield()
+#elif defined(AW_COMPILER_GCC_LIKE)
+    #if defined(AW_ARCH_X86)
+        #define aw_cpu_pause() __builtin_ia32_pause()
+    #elif defined(AW_ARCH_ARM)
+        #define aw_cpu_pause() __asm__ __volatile__("yield" ::: "memory")
+    #elif defined(AW_ARCH_RISCV)
+        #define aw_cpu_pause() __asm__ __volatile__(".4byte 0x100000f" ::: "memory")
+    #else
+        #define aw_cpu_pause() __asm__ __volatile__("" ::: "memory")
+    #endif
+#else
+    #define aw_cpu_pause() ((void)0)
+#endif
+
 
 #endif // AW_ATOMIC_BASE_H
\ No newline at end of file
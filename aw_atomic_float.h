@@ -0,0 +1,151 @@
+#ifndef AW_ATOMIC_FLOAT_H
+#define AW_ATOMIC_FLOAT_H
+
+#include "aw_atomic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Atomic Float (浮点原子类型)
+ * ============================================================================
+ * aw_atomic_double_t / aw_atomic_float_t 以 64 / 32 位无符号整数保存浮点数的
+ * 位模式，所有操作都经由整数原子路径完成 (各后端均已支持)，再按位转换回浮点。
+ *
+ * - CAS 按位比较: +0.0 与 -0.0 不相等，相同位模式的 NaN 相等。
+ *   aw_fetch_add_* 的重试循环同样按位比较，值为 NaN 时不会因 NaN != NaN 而死循环。
+ * - aw_fetch_add_f64 / _f32 为弱 CAS 循环 (C11 与 GCC 均不提供浮点 fetch_add)，
+ *   竞争激烈的累加建议先在线程内局部累加再合并。
+ *
+ * 示例:
+ *   static aw_atomic_double_t latency_sum;
+ *   aw_fetch_add_f64(&latency_sum, ms, AW_MO_RELAXED);
+ */
+
+typedef struct {
+    aw_atomic_ullong_t bits;
+} aw_atomic_double_t;
+
+typedef struct {
+    aw_atomic_uint_t bits;
+} aw_atomic_float_t;
+
+typedef union {
+    double             f;
+    unsigned long long u;
+} _aw_f64_bits_t;
+
+typedef union {
+    float        f;
+    unsigned int u;
+} _aw_f32_bits_t;
+
+AW_INLINE unsigned long long _aw_f64_to_bits(double v) {
+    _aw_f64_bits_t c;
+    c.f = v;
+    return c.u;
+}
+
+AW_INLINE double _aw_bits_to_f64(unsigned long long u) {
+    _aw_f64_bits_t c;
+    c.u = u;
+    return c.f;
+}
+
+AW_INLINE unsigned int _aw_f32_to_bits(float v) {
+    _aw_f32_bits_t c;
+    c.f = v;
+    return c.u;
+}
+
+AW_INLINE float _aw_bits_to_f32(unsigned int u) {
+    _aw_f32_bits_t c;
+    c.u = u;
+    return c.f;
+}
+
+// ============================================================================
+// 1. double
+// ============================================================================
+
+AW_INLINE void aw_atomic_double_init(aw_atomic_double_t* a, double v) {
+    aw_store(&a->bits, _aw_f64_to_bits(v), AW_MO_RELAXED);
+}
+
+AW_INLINE double aw_load_f64(aw_atomic_double_t* a, aw_memory_order order) {
+    return _aw_bits_to_f64(aw_load(&a->bits, order));
+}
+
+AW_INLINE void aw_store_f64(aw_atomic_double_t* a, double v, aw_memory_order order) {
+    aw_store(&a->bits, _aw_f64_to_bits(v), order);
+}
+
+AW_INLINE double aw_exchange_f64(aw_atomic_double_t* a, double v, aw_memory_order order) {
+    return _aw_bits_to_f64(aw_exchange(&a->bits, _aw_f64_to_bits(v), order));
+}
+
+// 失败时把当前值写回 *expected
+AW_INLINE bool aw_cas_f64(aw_atomic_double_t* a, double* expected, double desired,
+                          aw_memory_order succ, aw_memory_order fail) {
+    unsigned long long exp = _aw_f64_to_bits(*expected);
+    bool ok = aw_cas(&a->bits, &exp, _aw_f64_to_bits(desired), succ, fail);
+    if (!ok) {
+        *expected = _aw_bits_to_f64(exp);
+    }
+    return ok;
+}
+
+// 返回加法前的旧值
+AW_INLINE double aw_fetch_add_f64(aw_atomic_double_t* a, double v, aw_memory_order order) {
+    unsigned long long old = aw_load(&a->bits, AW_MO_RELAXED);
+    while (!aw_cas_weak(&a->bits, &old, _aw_f64_to_bits(_aw_bits_to_f64(old) + v),
+                        order, AW_MO_RELAXED)) {
+    }
+    return _aw_bits_to_f64(old);
+}
+
+// ============================================================================
+// 2. float
+// ============================================================================
+
+AW_INLINE void aw_atomic_float_init(aw_atomic_float_t* a, float v) {
+    aw_store(&a->bits, _aw_f32_to_bits(v), AW_MO_RELAXED);
+}
+
+AW_INLINE float aw_load_f32(aw_atomic_float_t* a, aw_memory_order order) {
+    return _aw_bits_to_f32(aw_load(&a->bits, order));
+}
+
+AW_INLINE void aw_store_f32(aw_atomic_float_t* a, float v, aw_memory_order order) {
+    aw_store(&a->bits, _aw_f32_to_bits(v), order);
+}
+
+AW_INLINE float aw_exchange_f32(aw_atomic_float_t* a, float v, aw_memory_order order) {
+    return _aw_bits_to_f32(aw_exchange(&a->bits, _aw_f32_to_bits(v), order));
+}
+
+AW_INLINE bool aw_cas_f32(aw_atomic_float_t* a, float* expected, float desired,
+                          aw_memory_order succ, aw_memory_order fail) {
+    unsigned int exp = _aw_f32_to_bits(*expected);
+    bool ok = aw_cas(&a->bits, &exp, _aw_f32_to_bits(desired), succ, fail);
+    if (!ok) {
+        *expected = _aw_bits_to_f32(exp);
+    }
+    return ok;
+}
+
+AW_INLINE float aw_fetch_add_f32(aw_atomic_float_t* a, float v, aw_memory_order order) {
+    unsigned int old = aw_load(&a->bits, AW_MO_RELAXED);
+    while (!aw_cas_weak(&a->bits, &old, _aw_f32_to_bits(_aw_bits_to_f32(old) + v),
+                        order, AW_MO_RELAXED)) {
+    }
+    return _aw_bits_to_f32(old);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_ATOMIC_FLOAT_H
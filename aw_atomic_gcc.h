@@ -3,7 +3,7 @@
 
 #include "aw_atomic_base.h"
 
-#ifdef AW_COMPILER_GCC_LIKE
+#if AW_BACKEND == AW_BACKEND_GCC_BUILTIN
 
 // GCC 内置函数在类型方面具有通用性。
 // 我们定义了一些宏来直接传递参数。
@@ -20,6 +20,9 @@
 #define _aw_impl_cas(ptr, exp, des, succ, fail) \
     __atomic_compare_exchange_n(ptr, exp, des, 0, succ, fail)
 
+#define _aw_impl_cas_weak(ptr, exp, des, succ, fail) \
+    __atomic_compare_exchange_n(ptr, exp, des, 1, succ, fail)
+
 #define _aw_impl_fetch_add(ptr, val, order) \
     __atomic_fetch_add(ptr, val, order)
 
@@ -41,6 +44,21 @@
 #define _aw_impl_signal_fence(order) \
     __atomic_signal_fence(order)
 
-#endif // AW_COMPILER_GCC_LIKE
+// 双字操作使用通用 (非 _n) 版本的内置函数，操作数为 16 字节 (32 位平台为 8 字节)。
+// x86-64 上对应 cmpxchg16b，AArch64 上对应 CASP / LDXP+STXP；
+// GCC 会把 16 字节原子操作交给 libatomic (链接时需 -latomic)，
+// 在不支持双字 CAS 的 CPU 上 libatomic 退化为加锁实现。
+AW_INLINE aw_dw_t _aw_impl_load_dw(aw_atomic_dw_t* ptr, aw_memory_order order) {
+    aw_dw_t v;
+    __atomic_load(ptr, &v, order);
+    return v;
+}
+
+AW_INLINE bool _aw_impl_cas_dw(aw_atomic_dw_t* ptr, aw_dw_t* exp, aw_dw_t des,
+                               aw_memory_order succ, aw_memory_order fail) {
+    return __atomic_compare_exchange(ptr, exp, &des, 0, succ, fail);
+}
+
+#endif // AW_BACKEND_GCC_BUILTIN
 
 #endif // AW_BACKEND_GCC_H
\ No newline at end of file
@@ -2,8 +2,9 @@
 #define AW_AWTOMIC_MSVC_H
 
 #include "aw_atomic_base.h"
+#include <string.h>
 
-#ifdef AW_COMPILER_MSVC
+#if AW_BACKEND == AW_BACKEND_MSVC
 
 // ----------------------------------------------------------------------------
 // MSVC 显式屏障辅助
@@ -161,6 +162,29 @@ AW_INLINE long long _aw_msvc_fetch_xor_64(volatile long long* ptr, long long val
     return _InterlockedXor64(ptr, val);
 }
 
-#endif // AW_COMPILER_MSVC
+// ----------------------------------------------------------------------------
+// Double-width Implementation (x64/ARM64: 128-bit, x86: 64-bit)
+// ----------------------------------------------------------------------------
+AW_INLINE bool _aw_msvc_cas_dw(volatile aw_dw_t* ptr, aw_dw_t* exp, aw_dw_t des, aw_memory_order succ, aw_memory_order fail) {
+#if AW_DW_SIZE == 16
+    return _InterlockedCompareExchange128((volatile long long*)ptr, (long long)des.hi, (long long)des.lo, (long long*)exp) != 0;
+#else
+    long long old, val, prev;
+    memcpy(&old, exp, sizeof(old));
+    memcpy(&val, &des, sizeof(val));
+    prev = _InterlockedCompareExchange64((volatile long long*)ptr, val, old);
+    if (prev == old) return true;
+    memcpy(exp, &prev, sizeof(prev));
+    return false;
+#endif
+}
+// 没有双字原子读取指令，以 "期望值 = 新值 = 0" 的 CAS 读取当前值
+AW_INLINE aw_dw_t _aw_msvc_load_dw(volatile aw_dw_t* ptr, aw_memory_order order) {
+    aw_dw_t v = { 0, 0 };
+    _aw_msvc_cas_dw(ptr, &v, v, order, order);
+    return v;
+}
+
+#endif // AW_BACKEND_MSVC
 
 #endif // AW_AWTOMIC_MSVC_H
\ No newline at end of file
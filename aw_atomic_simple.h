@@ -93,6 +93,19 @@ extern "C" {
 #define aw_cas_rlx(ptr, exp_ptr, des) \
     aw_cas(ptr, exp_ptr, des, AW_MO_RELAXED, AW_MO_RELAXED)
 
+// 弱 CAS 版本: 允许伪失败，用于本身就在重试的循环中 (LL/SC 架构上更省指令)
+#define aw_cas_weak_ar(ptr, exp_ptr, des) \
+    aw_cas_weak(ptr, exp_ptr, des, AW_MO_ACQ_REL, AW_MO_ACQUIRE)
+
+#define aw_cas_weak_acq(ptr, exp_ptr, des) \
+    aw_cas_weak(ptr, exp_ptr, des, AW_MO_ACQUIRE, AW_MO_ACQUIRE)
+
+#define aw_cas_weak_rel(ptr, exp_ptr, des) \
+    aw_cas_weak(ptr, exp_ptr, des, AW_MO_RELEASE, AW_MO_RELAXED)
+
+#define aw_cas_weak_rlx(ptr, exp_ptr, des) \
+    aw_cas_weak(ptr, exp_ptr, des, AW_MO_RELAXED, AW_MO_RELAXED)
+
 
 // ============================================================================
 // 5. Arithmetic (Fetch Add / Sub)
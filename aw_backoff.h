@@ -0,0 +1,68 @@
+#ifndef AW_BACKOFF_H
+#define AW_BACKOFF_H
+
+#include "aw_atomic_base.h"
+
+#ifdef AW_ATOMIC_PROFILE
+    #include "aw_atomic.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Bounded Exponential Backoff (有界指数退避)
+ * ============================================================================
+ * 用于自旋等待循环: 每次等待失败后执行的 aw_cpu_pause() 次数翻倍，
+ * 直到达到上限 AW_BACKOFF_MAX_SPINS。这样在高竞争下等待者会逐渐错开
+ * 重试时间，避免所有线程在锁释放的瞬间同时发起 RMW 抢占同一缓存行。
+ *
+ * 示例:
+ *   aw_backoff_t bo = AW_BACKOFF_INIT;
+ *   while (!try_something()) aw_backoff_spin(&bo);
+ */
+
+// 单次退避的最大 pause 次数 (可在包含本头文件前覆盖)
+#ifndef AW_BACKOFF_MAX_SPINS
+#define AW_BACKOFF_MAX_SPINS 1024u
+#endif
+
+typedef struct {
+    unsigned int spins;     // 下一次退避要执行的 pause 次数
+} aw_backoff_t;
+
+#define AW_BACKOFF_INIT { 1u }
+
+AW_INLINE void aw_backoff_init(aw_backoff_t* bo) {
+    bo->spins = 1u;
+}
+
+// 执行一次退避，并把下一次的退避时长翻倍 (不超过上限)
+AW_INLINE void aw_backoff_spin(aw_backoff_t* bo) {
+    unsigned int i;
+    for (i = 0; i < bo->spins; i++) {
+        aw_cpu_pause();
+    }
+    if (bo->spins < AW_BACKOFF_MAX_SPINS) {
+        bo->spins <<= 1;
+    }
+}
+
+#ifdef AW_ATOMIC_PROFILE
+    // 按调用点记录退避次数与 pause 次数 (见 aw_profile.h)
+    #define aw_backoff_spin(bo) \
+        (_aw_prof_spin((bo)->spins, __FILE__, __LINE__), aw_backoff_spin(bo))
+#endif
+
+// 退避是否已经达到上限 (调用方可据此切换到让出 CPU / 阻塞等待)
+AW_INLINE bool aw_backoff_saturated(const aw_backoff_t* bo) {
+    return bo->spins >= AW_BACKOFF_MAX_SPINS;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_BACKOFF_H
@@ -0,0 +1,265 @@
+#ifndef AW_BITMAP_H
+#define AW_BITMAP_H
+
+#include "aw_thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Bitmap Allocator (无锁位图 ID / 槽位分配器)
+ * ============================================================================
+ * 每个 ID 对应位图中的一位 (1: 已分配)。位图按 64 位字组织:
+ *
+ * - 分配: 对字取反后 ctz 找到最低的空闲位，再以 aw_bit_test_and_set 抢占
+ *   (x86 上为 lock bts)，抢占失败则在同一字中继续寻找;
+ * - 释放: aw_fetch_and 清除对应位;
+ * - 游标: 线程按 aw_thread_hint() 映射到 AW_BITMAP_CURSORS 个游标之一，从游标
+ *   所指的字开始扫描，并记住最近一次成功的位置，不同线程不会都挤在第 0 个字上;
+ * - 摘要: 每个字在摘要位图中对应一位 (1: 该字已满)，扫描时可整段跳过已满的
+ *   区域。摘要只是提示，分配者置位摘要后会再检查一次该字，若已不满则撤销，
+ *   因此摘要不会把仍有空位的字长期隐藏。
+ *
+ * 存储区由调用方提供，大小为 AW_BITMAP_MEM_SIZE(nbits) 字节，按 8 字节对齐。
+ *
+ * 示例:
+ *   static unsigned long long ids_mem[AW_BITMAP_MEM_SIZE(65536) / 8];
+ *   static aw_bitmap_t ids;
+ *   aw_bitmap_init(&ids, ids_mem, 65536);
+ *   long id = aw_bitmap_alloc(&ids);       // 耗尽时返回 -1
+ *   aw_bitmap_free(&ids, id);
+ */
+
+#ifndef AW_BITMAP_CURSORS
+#define AW_BITMAP_CURSORS 16
+#endif
+
+#define AW_BITMAP_WORDS(nbits)         (((nbits) + 63) / 64)
+#define AW_BITMAP_SUMMARY_WORDS(nbits) ((AW_BITMAP_WORDS(nbits) + 63) / 64)
+#define AW_BITMAP_MEM_SIZE(nbits) \
+    ((AW_BITMAP_WORDS(nbits) + AW_BITMAP_SUMMARY_WORDS(nbits)) * sizeof(aw_atomic_ullong_t))
+
+#define _AW_BITMAP_FULL (~0ULL)
+
+typedef struct {
+    aw_atomic_ullong_t*     words;                       // 位图本体
+    aw_atomic_ullong_t*     summary;                     // 每个字一位: 1 表示已满
+    size_t                  nbits;
+    size_t                  nwords;
+    aw_padded_atomic_size_t cursors[AW_BITMAP_CURSORS];  // 各线程组的起始字
+} aw_bitmap_t;
+
+// ============================================================================
+// 1. 位扫描
+// ============================================================================
+
+// 最低置位的下标，v 不能为 0
+AW_INLINE unsigned int _aw_ctz64(unsigned long long v) {
+#if defined(AW_COMPILER_GCC_LIKE)
+    return (unsigned int)__builtin_ctzll(v);
+#elif defined(AW_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long idx;
+    _BitScanForward64(&idx, v);
+    return (unsigned int)idx;
+#elif defined(AW_COMPILER_MSVC)
+    unsigned long idx;
+    if (_BitScanForward(&idx, (unsigned long)v)) {
+        return (unsigned int)idx;
+    }
+    _BitScanForward(&idx, (unsigned long)(v >> 32));
+    return (unsigned int)idx + 32;
+#else
+    unsigned int n = 0;
+    while ((v & 1) == 0) {
+        v >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+// 返回掩码: 第 j 位为 1 表示 free 的 [j, j + n) 位全部为 1 (1 <= n <= 64)
+AW_INLINE unsigned long long _aw_bitmap_runs(unsigned long long free, unsigned int n) {
+    unsigned int k = 1;
+
+    while (k < n && free != 0) {
+        unsigned int s = (n - k < k) ? (n - k) : k;
+        free &= free >> s;
+        k += s;
+    }
+    return free;
+}
+
+AW_INLINE unsigned long long _aw_bitmap_mask(unsigned int bit, unsigned int n) {
+    return (n == 64 ? _AW_BITMAP_FULL : ((1ULL << n) - 1)) << bit;
+}
+
+// ============================================================================
+// 2. 初始化
+// ============================================================================
+
+// mem 至少 AW_BITMAP_MEM_SIZE(nbits) 字节，所有 ID 初始为空闲
+AW_INLINE bool aw_bitmap_init(aw_bitmap_t* b, void* mem, size_t nbits) {
+    size_t nsummary, i;
+
+    if (mem == NULL || nbits == 0) {
+        return false;
+    }
+    b->words   = (aw_atomic_ullong_t*)mem;
+    b->nbits   = nbits;
+    b->nwords  = AW_BITMAP_WORDS(nbits);
+    b->summary = b->words + b->nwords;
+    nsummary   = AW_BITMAP_SUMMARY_WORDS(nbits);
+
+    for (i = 0; i < b->nwords; i++) {
+        aw_store_rlx(&b->words[i], 0ULL);
+    }
+    // 末尾不存在的 ID 预先置 1，永远不会被分配
+    if (nbits % 64 != 0) {
+        aw_store_rlx(&b->words[b->nwords - 1], _AW_BITMAP_FULL << (nbits % 64));
+    }
+    for (i = 0; i < nsummary; i++) {
+        aw_store_rlx(&b->summary[i], 0ULL);
+    }
+    for (i = 0; i < AW_BITMAP_CURSORS; i++) {
+        aw_store_rlx(&b->cursors[i].value, b->nwords * i / AW_BITMAP_CURSORS);
+    }
+    aw_fence_rel();
+    return true;
+}
+
+// ============================================================================
+// 3. 摘要维护
+// ============================================================================
+
+AW_INLINE void _aw_bitmap_mark_full(aw_bitmap_t* b, size_t w) {
+    aw_atomic_ullong_t* s = &b->summary[w / 64];
+    unsigned long long bit = 1ULL << (w % 64);
+
+    aw_fetch_or(s, bit, AW_MO_SEQ_CST);
+    // 置位与释放者的 "清字 -> 清摘要" 之间可能交错，复查一次避免误标
+    if (aw_load(&b->words[w], AW_MO_SEQ_CST) != _AW_BITMAP_FULL) {
+        aw_fetch_and(s, ~bit, AW_MO_SEQ_CST);
+    }
+}
+
+AW_INLINE void _aw_bitmap_mark_free(aw_bitmap_t* b, size_t w) {
+    aw_atomic_ullong_t* s = &b->summary[w / 64];
+    unsigned long long bit = 1ULL << (w % 64);
+
+    if (aw_load(s, AW_MO_SEQ_CST) & bit) {
+        aw_fetch_and(s, ~bit, AW_MO_SEQ_CST);
+    }
+}
+
+// ============================================================================
+// 4. 分配与释放
+// ============================================================================
+
+// 在字 w 中分配 n 个连续位，成功返回起始位下标，否则返回 -1
+AW_INLINE int _aw_bitmap_try_word(aw_bitmap_t* b, size_t w, unsigned int n) {
+    aw_atomic_ullong_t* word = &b->words[w];
+    unsigned long long v = aw_load_rlx(word);
+
+    while (v != _AW_BITMAP_FULL) {
+        unsigned long long runs = _aw_bitmap_runs(~v, n);
+        unsigned int bit;
+
+        if (runs == 0) {
+            return -1;
+        }
+        bit = _aw_ctz64(runs);
+        if (n == 1) {
+            // 单个位: lock bts，失败说明被别人抢先，重新读取
+            if (!aw_bit_test_and_set(word, bit, AW_MO_SEQ_CST)) {
+                if (aw_load_rlx(word) == _AW_BITMAP_FULL) {
+                    _aw_bitmap_mark_full(b, w);
+                }
+                return (int)bit;
+            }
+            v = aw_load_rlx(word);
+        } else {
+            unsigned long long nv = v | _aw_bitmap_mask(bit, n);
+            if (aw_cas_weak(word, &v, nv, AW_MO_SEQ_CST, AW_MO_RELAXED)) {
+                if (nv == _AW_BITMAP_FULL) {
+                    _aw_bitmap_mark_full(b, w);
+                }
+                return (int)bit;
+            }
+        }
+    }
+    return -1;
+}
+
+// 分配同一个字内的 n 个连续 ID (1 <= n <= 64)，返回首个 ID，失败返回 -1。
+// 连续区间不跨越 64 位字的边界 (一次 CAS 只能占用一个字)，空闲区间跨字时
+// 即使总长度足够也分配不到
+AW_INLINE long aw_bitmap_alloc_n(aw_bitmap_t* b, unsigned int n) {
+    aw_atomic_size_t* cursor = &b->cursors[aw_thread_hint() % AW_BITMAP_CURSORS].value;
+    size_t start = aw_load_rlx(cursor);
+    size_t i = 0;
+
+    if (n == 0 || n > 64) {
+        return -1;
+    }
+    if (start >= b->nwords) {
+        start = 0;
+    }
+    while (i < b->nwords) {
+        size_t w = (start + i) % b->nwords;
+        unsigned long long sum = aw_load_rlx(&b->summary[w / 64]);
+        int bit;
+
+        if (sum & (1ULL << (w % 64))) {
+            // 直接跳到摘要中下一个未满的字 (本摘要字剩余部分全满时跳到下一个
+            // 摘要字)，不越过回绕点
+            unsigned long long open = ~sum >> (w % 64);
+            size_t skip = open != 0 ? _aw_ctz64(open) : 64 - w % 64;
+            if (skip > b->nwords - w) {
+                skip = b->nwords - w;
+            }
+            i += skip;
+            continue;
+        }
+        bit = _aw_bitmap_try_word(b, w, n);
+        if (bit >= 0) {
+            if (w != start) {
+                aw_store_rlx(cursor, w);
+            }
+            return (long)(w * 64 + (size_t)bit);
+        }
+        i++;
+    }
+    return -1;
+}
+
+// 分配一个 ID，耗尽时返回 -1
+AW_INLINE long aw_bitmap_alloc(aw_bitmap_t* b) {
+    return aw_bitmap_alloc_n(b, 1);
+}
+
+// 释放 aw_bitmap_alloc_n 分配的 n 个连续 ID
+AW_INLINE void aw_bitmap_free_n(aw_bitmap_t* b, long id, unsigned int n) {
+    size_t w = (size_t)id / 64;
+    unsigned long long mask = _aw_bitmap_mask((unsigned int)((size_t)id % 64), n);
+
+    aw_fetch_and(&b->words[w], ~mask, AW_MO_SEQ_CST);
+    _aw_bitmap_mark_free(b, w);
+}
+
+AW_INLINE void aw_bitmap_free(aw_bitmap_t* b, long id) {
+    aw_bitmap_free_n(b, id, 1);
+}
+
+// 查询 ID 当前是否已分配 (仅供诊断)
+AW_INLINE bool aw_bitmap_test(aw_bitmap_t* b, long id) {
+    return (aw_load_acq(&b->words[(size_t)id / 64]) >> ((size_t)id % 64)) & 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_BITMAP_H
@@ -0,0 +1,225 @@
+#ifndef AW_EPOCH_H
+#define AW_EPOCH_H
+
+#include "aw_atomic_simple.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Epoch-Based Reclamation (基于纪元的内存回收)
+ * ============================================================================
+ * 适用于读远多于写的无锁结构: 读者进入/退出临界区只需一次 Relaxed 写入
+ * 加一次屏障 (进入) 和一次 Release 写入 (退出)，不需要像危险指针那样对
+ * 每个被访问的节点发布并校验。
+ *
+ * - 全局纪元 epoch 以 2 递增，读者进入临界区时把 "当前纪元 | 1" 写入自己的
+ *   公告槽位 (各线程槽位按缓存行对齐)，退出时清除活跃位。
+ * - 对象退休时挂入当前纪元对应的 limbo 链表 (共三代，按纪元模 3 轮转)。
+ * - 当所有活跃线程都已公告当前纪元时，纪元才能前进；某代 limbo 中的对象在
+ *   纪元前进两次之后一定不再被任何读者引用，可以安全回收。
+ * - 纪元为 64 位: 32 位纪元按 2 递增时 2^31 次推进后回绕，而 2^32 不是 3 的
+ *   倍数，回绕处 "纪元/2 模 3" 会跳代，导致尚被引用的对象被提前回收。
+ *
+ * 注意: 读者在临界区内长时间停顿会阻止纪元前进，此期间退休的对象都无法回收。
+ *
+ * 示例 (读者):
+ *   aw_epoch_enter(&dom, rec);
+ *   ... 遍历无锁结构 ...
+ *   aw_epoch_exit(&dom, rec);
+ * 示例 (删除者，摘除节点后):
+ *   aw_epoch_retire(&dom, rec, n, &n->ep, free);
+ */
+
+// 域内最多同时注册的线程数
+#ifndef AW_EPOCH_MAX_THREADS
+#define AW_EPOCH_MAX_THREADS 64
+#endif
+
+#define AW_EPOCH_ACTIVE 1ull    // 公告值中的活跃位
+#define AW_EPOCH_STEP   2ull    // 纪元递增步长 (最低位留给活跃位)
+
+// 退休节点，嵌入到待回收对象中
+typedef struct aw_epoch_node {
+    struct aw_epoch_node* next;
+    void*                 obj;
+    void                (*reclaim)(void* obj);
+} aw_epoch_node_t;
+
+// 按缓存行对齐，相邻记录的公告槽位不会落在同一缓存行
+typedef struct AW_CACHELINE_ALIGN {
+    aw_atomic_ullong_t announce;        // 公告纪元 | 活跃位 (其他线程只读)
+    aw_atomic_int_t   in_use;           // 记录是否已被线程领取
+
+    // --- 以下字段仅由持有该记录的线程访问 ---
+    unsigned int      nest;             // 临界区嵌套深度
+    unsigned long long local_epoch;     // 最近一次整理 limbo 时看到的纪元
+    aw_epoch_node_t*  limbo[3];
+    size_t            limbo_count;
+} aw_epoch_rec_t;
+
+typedef struct {
+    aw_atomic_ullong_t epoch;
+    char              _pad[AW_CACHELINE_SIZE - sizeof(aw_atomic_ullong_t)];
+    aw_epoch_rec_t    recs[AW_EPOCH_MAX_THREADS];
+    aw_atomic_int_t   rec_hwm;          // 曾被领取过的最大记录下标 + 1
+    size_t            threshold;        // 触发纪元推进的 limbo 数量
+} aw_epoch_domain_t;
+
+// threshold 为 0 时取 64
+AW_INLINE void aw_epoch_domain_init(aw_epoch_domain_t* dom, size_t threshold) {
+    int i;
+
+    aw_store_rlx(&dom->epoch, 0);
+    for (i = 0; i < AW_EPOCH_MAX_THREADS; i++) {
+        aw_epoch_rec_t* rec = &dom->recs[i];
+        aw_store_rlx(&rec->announce, 0);
+        aw_store_rlx(&rec->in_use, 0);
+        rec->nest        = 0;
+        rec->local_epoch = 0;
+        rec->limbo[0]    = NULL;
+        rec->limbo[1]    = NULL;
+        rec->limbo[2]    = NULL;
+        rec->limbo_count = 0;
+    }
+    aw_store_rlx(&dom->rec_hwm, 0);
+    dom->threshold = threshold ? threshold : 64;
+}
+
+// ============================================================================
+// 1. 线程记录
+// ============================================================================
+
+// 领取一个记录，域已满时返回 NULL。上一位持有者遗留的 limbo 对象会被一并继承
+AW_INLINE aw_epoch_rec_t* aw_epoch_acquire(aw_epoch_domain_t* dom) {
+    int i;
+
+    for (i = 0; i < AW_EPOCH_MAX_THREADS; i++) {
+        aw_epoch_rec_t* rec = &dom->recs[i];
+        int exp = 0;
+
+        if (aw_load_rlx(&rec->in_use) == 0 &&
+            aw_cas(&rec->in_use, &exp, 1, AW_MO_ACQUIRE, AW_MO_RELAXED)) {
+            int hwm = aw_load_rlx(&dom->rec_hwm);
+            while (hwm < i + 1 &&
+                   !aw_cas(&dom->rec_hwm, &hwm, i + 1, AW_MO_RELEASE, AW_MO_RELAXED)) {
+            }
+            return rec;
+        }
+    }
+    return NULL;
+}
+
+// 归还记录，必须在临界区之外调用
+AW_INLINE void aw_epoch_release(aw_epoch_rec_t* rec) {
+    aw_store_rel(&rec->in_use, 0);
+}
+
+// ============================================================================
+// 2. 读者临界区 (可嵌套)
+// ============================================================================
+
+AW_INLINE void aw_epoch_enter(aw_epoch_domain_t* dom, aw_epoch_rec_t* rec) {
+    if (rec->nest++ == 0) {
+        unsigned long long e = aw_load_rlx(&dom->epoch);
+        aw_store_rlx(&rec->announce, e | AW_EPOCH_ACTIVE);
+        // 公告必须先于临界区内对共享结构的读取对推进者可见 (Store-Load 顺序)
+        aw_fence_seq();
+    }
+}
+
+AW_INLINE void aw_epoch_exit(aw_epoch_domain_t* dom, aw_epoch_rec_t* rec) {
+    (void)dom;
+    if (--rec->nest == 0) {
+        // Release: 临界区内的读取先于活跃位的清除完成
+        aw_store_rel(&rec->announce, 0);
+    }
+}
+
+// ============================================================================
+// 3. 回收接口
+// ============================================================================
+
+// 所有活跃线程都已公告当前纪元时推进纪元，成功返回 true
+AW_INLINE bool aw_epoch_try_advance(aw_epoch_domain_t* dom) {
+    unsigned long long e = aw_load_acq(&dom->epoch);
+    int hwm, i;
+
+    aw_fence_seq();
+    hwm = aw_load_acq(&dom->rec_hwm);
+    for (i = 0; i < hwm; i++) {
+        unsigned long long a = aw_load_acq(&dom->recs[i].announce);
+        if ((a & AW_EPOCH_ACTIVE) != 0 && (a & ~AW_EPOCH_ACTIVE) != e) {
+            return false;
+        }
+    }
+    return aw_cas(&dom->epoch, &e, e + AW_EPOCH_STEP, AW_MO_ACQ_REL, AW_MO_RELAXED);
+}
+
+AW_INLINE void _aw_epoch_free_list(aw_epoch_rec_t* rec, int gen) {
+    aw_epoch_node_t* node = rec->limbo[gen];
+
+    rec->limbo[gen] = NULL;
+    while (node != NULL) {
+        aw_epoch_node_t* next = node->next;
+        node->reclaim(node->obj);
+        rec->limbo_count--;
+        node = next;
+    }
+}
+
+// 按当前全局纪元回收本记录中已经安全的 limbo 对象
+AW_INLINE void aw_epoch_collect(aw_epoch_domain_t* dom, aw_epoch_rec_t* rec) {
+    unsigned long long e    = aw_load_acq(&dom->epoch);
+    unsigned long long diff = (e - rec->local_epoch) / AW_EPOCH_STEP;
+
+    if (diff == 0) {
+        return;
+    }
+    if (diff >= 2) {
+        // 纪元已前进两次以上: 三代 limbo 全部安全
+        _aw_epoch_free_list(rec, 0);
+        _aw_epoch_free_list(rec, 1);
+        _aw_epoch_free_list(rec, 2);
+    } else {
+        // 前进一次: 只有当前纪元 - 2 那一代 (即下一代的槽位) 安全
+        _aw_epoch_free_list(rec, (int)((e / AW_EPOCH_STEP + 1) % 3));
+    }
+    rec->local_epoch = e;
+}
+
+// 退休对象 obj (node 为嵌入其中的退休节点)，limbo 数量达到阈值时尝试推进纪元
+AW_INLINE void aw_epoch_retire(aw_epoch_domain_t* dom, aw_epoch_rec_t* rec,
+                               void* obj, aw_epoch_node_t* node, void (*reclaim)(void* obj)) {
+    int gen;
+
+    aw_epoch_collect(dom, rec);
+    gen = (int)((rec->local_epoch / AW_EPOCH_STEP) % 3);
+
+    node->obj       = obj;
+    node->reclaim   = reclaim;
+    node->next      = rec->limbo[gen];
+    rec->limbo[gen] = node;
+    if (++rec->limbo_count >= dom->threshold && aw_epoch_try_advance(dom)) {
+        aw_epoch_collect(dom, rec);
+    }
+}
+
+// 回收域内所有记录中的 limbo 对象，仅在确认没有任何读者时调用 (如程序退出)
+AW_INLINE void aw_epoch_domain_drain(aw_epoch_domain_t* dom) {
+    int i;
+
+    for (i = 0; i < AW_EPOCH_MAX_THREADS; i++) {
+        _aw_epoch_free_list(&dom->recs[i], 0);
+        _aw_epoch_free_list(&dom->recs[i], 1);
+        _aw_epoch_free_list(&dom->recs[i], 2);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_EPOCH_H
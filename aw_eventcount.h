@@ -0,0 +1,109 @@
+#ifndef AW_EVENTCOUNT_H
+#define AW_EVENTCOUNT_H
+
+#include "aw_wait.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Eventcount (事件计数，为无锁结构提供不丢失唤醒的阻塞等待)
+ * ============================================================================
+ * 把 "检查条件 -> 挂起" 拆成两步，中间的条件检查由调用方完成，因此可以包在
+ * 任何无锁队列 (或其他基于 aw_atomic.h 的结构) 外面，而不需要在生产路径上加锁:
+ *
+ *   // 消费方
+ *   for (;;) {
+ *       if (aw_mpmc_queue_try_dequeue(&q, &item)) break;
+ *       unsigned int key = aw_eventcount_prepare_wait(&ec);
+ *       if (aw_mpmc_queue_try_dequeue(&q, &item)) {
+ *           aw_eventcount_cancel_wait(&ec);
+ *           break;
+ *       }
+ *       aw_eventcount_commit_wait(&ec, key);
+ *   }
+ *
+ *   // 生产方
+ *   aw_mpmc_queue_try_enqueue(&q, &item);
+ *   aw_eventcount_notify(&ec);
+ *
+ * 不丢失唤醒: 等待方 "登记 waiters -> 屏障 -> 再检查条件"，通知方
+ * "修改条件 -> 屏障 -> 读 waiters"，两者至少有一方能看到对方的写入；
+ * 通知方看到等待者时递增 epoch，prepare_wait 之后的任何通知都会让
+ * commit_wait 立即返回。
+ *
+ * 没有等待者时 notify 只有一次 SeqCst 屏障和一次 aw_load_rlx。挂起基于
+ * aw_wait (Linux 上为 epoch 字上的 futex)。
+ */
+
+typedef struct AW_CACHELINE_ALIGN {
+    aw_atomic_uint_t epoch;     // 每次有效通知加一 (futex 字)
+    aw_atomic_uint_t waiters;   // 已 prepare_wait 且尚未 commit / cancel 的等待者数
+} aw_eventcount_t;
+
+#define AW_EVENTCOUNT_INIT { AW_ATOMIC_VAR_INIT(0u), AW_ATOMIC_VAR_INIT(0u) }
+
+AW_INLINE void aw_eventcount_init(aw_eventcount_t* ec) {
+    aw_store_rlx(&ec->epoch, 0u);
+    aw_store_rlx(&ec->waiters, 0u);
+}
+
+// 登记为等待者并返回当前 epoch，之后调用方必须再检查一次等待条件
+AW_INLINE unsigned int aw_eventcount_prepare_wait(aw_eventcount_t* ec) {
+    aw_faa_rlx(&ec->waiters, 1u);
+    // 与通知方 "修改条件 -> 屏障 -> 读 waiters" 配对
+    aw_fence_seq();
+    return aw_load_acq(&ec->epoch);
+}
+
+// 再检查时条件已满足，放弃等待
+AW_INLINE void aw_eventcount_cancel_wait(aw_eventcount_t* ec) {
+    aw_fas_rlx(&ec->waiters, 1u);
+}
+
+// 挂起直到 prepare_wait 之后有通知到达 (返回后应重新检查条件)
+AW_INLINE void aw_eventcount_commit_wait(aw_eventcount_t* ec, unsigned int key) {
+    aw_wait(&ec->epoch, key, AW_MO_ACQUIRE);
+    aw_fas_rlx(&ec->waiters, 1u);
+}
+
+AW_INLINE bool _aw_eventcount_signal(aw_eventcount_t* ec) {
+    // 条件的修改先于 waiters 的读取
+    aw_fence_seq();
+    if (aw_load_rlx(&ec->waiters) == 0) {
+        return false;
+    }
+    aw_faa_rel(&ec->epoch, 1u);
+    return true;
+}
+
+// 条件变为满足后调用，唤醒一个等待者
+AW_INLINE void aw_eventcount_notify(aw_eventcount_t* ec) {
+    if (_aw_eventcount_signal(ec)) {
+        aw_notify_one(&ec->epoch);
+    }
+}
+
+// 只在看到等待者时才通知: 省去屏障，没有等待者时只有一次 aw_load_rlx。
+// 不保证不丢失唤醒 (读 waiters 可能早于条件的修改对等待方可见)，只用于
+// 丢失一次唤醒不影响正确性的场合，例如投递方自己随后也会处理该条件。
+AW_INLINE void aw_eventcount_notify_if_waiting(aw_eventcount_t* ec) {
+    if (aw_load_rlx(&ec->waiters) != 0) {
+        aw_eventcount_notify(ec);
+    }
+}
+
+// 唤醒所有等待者 (如关闭队列时)
+AW_INLINE void aw_eventcount_notify_all(aw_eventcount_t* ec) {
+    if (_aw_eventcount_signal(ec)) {
+        aw_notify_all(&ec->epoch);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_EVENTCOUNT_H
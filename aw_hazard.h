@@ -0,0 +1,234 @@
+#ifndef AW_HAZARD_H
+#define AW_HAZARD_H
+
+#include "aw_atomic_simple.h"
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Hazard Pointers (危险指针内存回收)
+ * ============================================================================
+ * 读者在解引用共享节点前把指针发布到自己的危险槽位中；删除节点的线程不直接
+ * 释放节点，而是先放入自己的退休链表 (retire)，待退休数量达到阈值时扫描所有
+ * 线程的危险槽位，只回收没有被任何槽位引用的节点。
+ *
+ * - 每个线程通过 aw_hazard_acquire 从域中领取一个记录 (aw_hazard_rec_t)，
+ *   记录按缓存行对齐，读者写自己的槽位不会干扰其他线程。
+ * - 受保护的节点最多 AW_HAZARD_MAX_THREADS * AW_HAZARD_SLOTS 个，
+ *   因此即使某个读者长时间停顿，每个线程未回收的节点数也不超过
+ *   "阈值 + 危险槽位总数"，垃圾总量有上界。
+ * - 阈值不小于危险槽位总数时，每次扫描至少回收 (阈值 - 槽位总数) 个节点，
+ *   扫描开销被均摊到每次 retire 上。
+ *
+ * 示例 (读者):
+ *   node_t* n = (node_t*)aw_hazard_protect(rec, 0, &list->head);
+ *   ... 使用 n ...
+ *   aw_hazard_clear(rec, 0);
+ * 示例 (删除者):
+ *   aw_hazard_retire(&dom, rec, n, &n->hz, free);
+ */
+
+// 域内最多同时注册的线程数
+#ifndef AW_HAZARD_MAX_THREADS
+#define AW_HAZARD_MAX_THREADS 64
+#endif
+
+// 每个线程的危险槽位数
+#ifndef AW_HAZARD_SLOTS
+#define AW_HAZARD_SLOTS 2
+#endif
+
+#define AW_HAZARD_TOTAL_SLOTS (AW_HAZARD_MAX_THREADS * AW_HAZARD_SLOTS)
+
+// 退休节点，嵌入到待回收对象中
+typedef struct aw_hazard_node {
+    struct aw_hazard_node* next;
+    void*                  obj;                 // 被保护/比较的对象地址
+    void                 (*reclaim)(void* obj); // 回收函数
+} aw_hazard_node_t;
+
+// 按缓存行对齐，相邻记录的槽位不会落在同一缓存行
+typedef struct AW_CACHELINE_ALIGN {
+    aw_atomic_ptr_t    slots[AW_HAZARD_SLOTS];  // 危险槽位 (其他线程只读)
+    aw_atomic_int_t    active;                  // 记录是否已被线程领取
+
+    // --- 以下字段仅由持有该记录的线程访问 ---
+    aw_hazard_node_t*  retired;
+    size_t             retired_count;
+} aw_hazard_rec_t;
+
+typedef struct {
+    aw_hazard_rec_t  recs[AW_HAZARD_MAX_THREADS];
+    aw_atomic_int_t  rec_hwm;                   // 曾被领取过的最大记录下标 + 1
+    size_t           threshold;                 // 触发扫描的退休数量
+} aw_hazard_domain_t;
+
+// threshold 为 0 时使用 2 * 危险槽位总数
+AW_INLINE void aw_hazard_domain_init(aw_hazard_domain_t* dom, size_t threshold) {
+    int i, j;
+
+    for (i = 0; i < AW_HAZARD_MAX_THREADS; i++) {
+        for (j = 0; j < AW_HAZARD_SLOTS; j++) {
+            aw_store_rlx(&dom->recs[i].slots[j], NULL);
+        }
+        aw_store_rlx(&dom->recs[i].active, 0);
+        dom->recs[i].retired       = NULL;
+        dom->recs[i].retired_count = 0;
+    }
+    aw_store_rlx(&dom->rec_hwm, 0);
+    dom->threshold = threshold ? threshold : 2 * AW_HAZARD_TOTAL_SLOTS;
+}
+
+// ============================================================================
+// 1. 线程记录
+// ============================================================================
+
+// 领取一个记录，域已满时返回 NULL。上一位持有者遗留的退休节点会被一并继承
+AW_INLINE aw_hazard_rec_t* aw_hazard_acquire(aw_hazard_domain_t* dom) {
+    int i;
+
+    for (i = 0; i < AW_HAZARD_MAX_THREADS; i++) {
+        aw_hazard_rec_t* rec = &dom->recs[i];
+        int exp = 0;
+
+        if (aw_load_rlx(&rec->active) == 0 &&
+            aw_cas(&rec->active, &exp, 1, AW_MO_ACQUIRE, AW_MO_RELAXED)) {
+            int hwm = aw_load_rlx(&dom->rec_hwm);
+            while (hwm < i + 1 &&
+                   !aw_cas(&dom->rec_hwm, &hwm, i + 1, AW_MO_RELEASE, AW_MO_RELAXED)) {
+            }
+            return rec;
+        }
+    }
+    return NULL;
+}
+
+// 归还记录。未回收的退休节点留在记录中，由下一位持有者继续处理
+AW_INLINE void aw_hazard_release(aw_hazard_rec_t* rec) {
+    int j;
+
+    for (j = 0; j < AW_HAZARD_SLOTS; j++) {
+        aw_store_rel(&rec->slots[j], NULL);
+    }
+    aw_store_rel(&rec->active, 0);
+}
+
+// ============================================================================
+// 2. 读者接口
+// ============================================================================
+
+// 直接发布 ptr 到槽位，调用方需自行在之后重新校验 ptr 仍然可达
+AW_INLINE void aw_hazard_set(aw_hazard_rec_t* rec, int slot, void* ptr) {
+    aw_store_rel(&rec->slots[slot], ptr);
+    // 保证槽位写入先于后续对源指针的重新读取 (Store-Load 顺序)
+    aw_fence_seq();
+}
+
+// 读取 *src 并保护，返回在发布后经过校验仍然有效的指针
+AW_INLINE void* aw_hazard_protect(aw_hazard_rec_t* rec, int slot, aw_atomic_ptr_t* src) {
+    void* p = (void*)aw_load_rlx(src);
+
+    for (;;) {
+        void* q;
+
+        aw_hazard_set(rec, slot, p);
+        q = (void*)aw_load_acq(src);
+        if (q == p) {
+            return p;
+        }
+        p = q;
+    }
+}
+
+AW_INLINE void aw_hazard_clear(aw_hazard_rec_t* rec, int slot) {
+    aw_store_rel(&rec->slots[slot], NULL);
+}
+
+// ============================================================================
+// 3. 回收接口
+// ============================================================================
+
+AW_INLINE int _aw_hazard_cmp(const void* a, const void* b) {
+    uintptr_t x = *(const uintptr_t*)a;
+    uintptr_t y = *(const uintptr_t*)b;
+    return (x > y) - (x < y);
+}
+
+// 扫描所有危险槽位，回收本记录中未被保护的退休节点
+AW_INLINE void aw_hazard_scan(aw_hazard_domain_t* dom, aw_hazard_rec_t* rec) {
+    uintptr_t          hp[AW_HAZARD_TOTAL_SLOTS];
+    size_t             nhp = 0;
+    int                hwm, i, j;
+    aw_hazard_node_t*  node;
+    aw_hazard_node_t*  keep = NULL;
+    size_t             kept = 0;
+
+    // 与读者的 aw_hazard_set 配对: 节点已从结构中摘除的写入先于槽位读取
+    aw_fence_seq();
+
+    hwm = aw_load_acq(&dom->rec_hwm);
+    for (i = 0; i < hwm; i++) {
+        for (j = 0; j < AW_HAZARD_SLOTS; j++) {
+            void* p = (void*)aw_load_acq(&dom->recs[i].slots[j]);
+            if (p != NULL) {
+                hp[nhp++] = (uintptr_t)p;
+            }
+        }
+    }
+    qsort(hp, nhp, sizeof(hp[0]), _aw_hazard_cmp);
+
+    node = rec->retired;
+    while (node != NULL) {
+        aw_hazard_node_t* next = node->next;
+        uintptr_t key = (uintptr_t)node->obj;
+
+        if (nhp != 0 && bsearch(&key, hp, nhp, sizeof(hp[0]), _aw_hazard_cmp) != NULL) {
+            node->next = keep;
+            keep = node;
+            kept++;
+        } else {
+            node->reclaim(node->obj);
+        }
+        node = next;
+    }
+    rec->retired       = keep;
+    rec->retired_count = kept;
+}
+
+// 退休对象 obj (node 为嵌入其中的退休节点)，达到阈值时触发扫描
+AW_INLINE void aw_hazard_retire(aw_hazard_domain_t* dom, aw_hazard_rec_t* rec,
+                                void* obj, aw_hazard_node_t* node, void (*reclaim)(void* obj)) {
+    node->obj     = obj;
+    node->reclaim = reclaim;
+    node->next    = rec->retired;
+    rec->retired  = node;
+    if (++rec->retired_count >= dom->threshold) {
+        aw_hazard_scan(dom, rec);
+    }
+}
+
+// 回收域内所有记录中的退休节点，仅在确认没有任何读者时调用 (如程序退出)
+AW_INLINE void aw_hazard_domain_drain(aw_hazard_domain_t* dom) {
+    int i;
+
+    for (i = 0; i < AW_HAZARD_MAX_THREADS; i++) {
+        aw_hazard_node_t* node = dom->recs[i].retired;
+        while (node != NULL) {
+            aw_hazard_node_t* next = node->next;
+            node->reclaim(node->obj);
+            node = next;
+        }
+        dom->recs[i].retired       = NULL;
+        dom->recs[i].retired_count = 0;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_HAZARD_H
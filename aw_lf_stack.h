@@ -0,0 +1,155 @@
+#ifndef AW_LF_STACK_H
+#define AW_LF_STACK_H
+
+#include "aw_atomic_simple.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Lock-free Stack (Treiber 栈，带标签指针防 ABA)
+ * ============================================================================
+ * 栈顶是一个 64 位字: 低 AW_LF_PTR_BITS 位存节点指针，高位存代数标签。
+ * 每次 push / pop 都会使标签加一，因此即使同一个节点被弹出后又压回，
+ * 持有旧栈顶快照的线程的 aw_cas 也会失败，从而避免 ABA 问题。
+ * - 64 位平台: 用户态地址只使用低 48 位 (x86-64 四级页表 / AArch64)，
+ *   剩余 16 位作为标签；若启用了 57 位地址 (LA57)，可将 AW_LF_PTR_BITS 覆盖为 57。
+ * - 32 位平台: 指针与 32 位标签各占一半。
+ *
+ * 节点 aw_lf_node_t 嵌入用户结构体。pop 会读取栈顶节点的 next，
+ * 因此节点内存在栈仍可能被访问期间不能归还给操作系统 (可以复用，
+ * 例如作为固定大小缓冲区的空闲链表)；需要真正释放时应配合安全回收机制。
+ */
+
+#ifndef AW_LF_PTR_BITS
+    #if UINTPTR_MAX > 0xFFFFFFFFu
+        #define AW_LF_PTR_BITS 48
+    #else
+        #define AW_LF_PTR_BITS 32
+    #endif
+#endif
+
+#define AW_LF_PTR_MASK ((1ULL << AW_LF_PTR_BITS) - 1)
+#define AW_LF_TAG_ONE  (1ULL << AW_LF_PTR_BITS)
+
+typedef struct aw_lf_node {
+    aw_atomic_ptr_t next;       // aw_lf_node_t*
+} aw_lf_node_t;
+
+typedef struct {
+    aw_atomic_ullong_t head;    // [标签 | 指针]
+} aw_lf_stack_t;
+
+#define AW_LF_STACK_INIT { AW_ATOMIC_VAR_INIT(0) }
+
+AW_INLINE aw_lf_node_t* _aw_lf_ptr(unsigned long long v) {
+    return (aw_lf_node_t*)(uintptr_t)(v & AW_LF_PTR_MASK);
+}
+
+// 以 old 的标签加一，与新的栈顶指针组合
+AW_INLINE unsigned long long _aw_lf_pack(unsigned long long old, aw_lf_node_t* node) {
+    return ((old & ~AW_LF_PTR_MASK) + AW_LF_TAG_ONE) | ((unsigned long long)(uintptr_t)node & AW_LF_PTR_MASK);
+}
+
+AW_INLINE void aw_lf_stack_init(aw_lf_stack_t* s) {
+    aw_store_rlx(&s->head, 0);
+}
+
+// 在构建批量链表时链接两个节点 (链表发布前调用，无需同步)
+AW_INLINE void aw_lf_node_link(aw_lf_node_t* node, aw_lf_node_t* next) {
+    aw_store_rlx(&node->next, (void*)next);
+}
+
+// 把已链接好的 first..last 整条链表一次性压栈 (first 成为新栈顶)
+AW_INLINE void aw_lf_stack_push_list(aw_lf_stack_t* s, aw_lf_node_t* first, aw_lf_node_t* last) {
+    unsigned long long old = aw_load_rlx(&s->head);
+
+    do {
+        aw_store_rlx(&last->next, (void*)_aw_lf_ptr(old));
+    } while (!aw_cas(&s->head, &old, _aw_lf_pack(old, first), AW_MO_RELEASE, AW_MO_RELAXED));
+}
+
+AW_INLINE void aw_lf_stack_push(aw_lf_stack_t* s, aw_lf_node_t* node) {
+    aw_lf_stack_push_list(s, node, node);
+}
+
+// 弹出栈顶节点，栈为空时返回 NULL
+AW_INLINE aw_lf_node_t* aw_lf_stack_pop(aw_lf_stack_t* s) {
+    unsigned long long old = aw_load_acq(&s->head);
+
+    for (;;) {
+        aw_lf_node_t* node = _aw_lf_ptr(old);
+        aw_lf_node_t* next;
+
+        if (node == NULL) {
+            return NULL;
+        }
+        // node 可能已被其他线程弹出并复用，读到的 next 可能是无效值，
+        // 但此时栈顶标签已经变化，下面的 CAS 必然失败
+        next = (aw_lf_node_t*)aw_load_rlx(&node->next);
+        if (aw_cas(&s->head, &old, _aw_lf_pack(old, next), AW_MO_ACQUIRE, AW_MO_ACQUIRE)) {
+            return node;
+        }
+    }
+}
+
+// 一次取走整个栈，返回原栈顶 (按 next 链接，以 NULL 结尾)。
+// 使用 aw_fetch_and 只清除指针位并保留标签，使后续 push 的标签仍然单调递增
+AW_INLINE aw_lf_node_t* aw_lf_stack_pop_all(aw_lf_stack_t* s) {
+    unsigned long long old = aw_fetch_and(&s->head, ~AW_LF_PTR_MASK, AW_MO_ACQUIRE);
+    return _aw_lf_ptr(old);
+}
+
+// 仅供参考，结果在返回时可能已经过期
+AW_INLINE bool aw_lf_stack_empty(aw_lf_stack_t* s) {
+    return _aw_lf_ptr(aw_load_rlx(&s->head)) == NULL;
+}
+
+// ============================================================================
+// 固定大小块的无锁空闲链表
+// ============================================================================
+// 把调用方提供的内存区切分成 block_size 大小的块挂入空闲栈。
+// 块在空闲时其头部被 aw_lf_node_t 占用，分配出去后整个块归用户使用。
+
+typedef struct {
+    aw_lf_stack_t free;
+    size_t        block_size;
+} aw_lf_freelist_t;
+
+// block_size 会被向上取整到指针大小的整数倍，返回实际切分出的块数
+AW_INLINE size_t aw_lf_freelist_init(aw_lf_freelist_t* fl, void* mem, size_t bytes, size_t block_size) {
+    unsigned char* p = (unsigned char*)mem;
+    size_t n = 0;
+
+    if (block_size < sizeof(aw_lf_node_t)) {
+        block_size = sizeof(aw_lf_node_t);
+    }
+    block_size = (block_size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+
+    fl->block_size = block_size;
+    aw_lf_stack_init(&fl->free);
+    while (bytes >= block_size) {
+        aw_lf_stack_push(&fl->free, (aw_lf_node_t*)p);
+        p     += block_size;
+        bytes -= block_size;
+        n++;
+    }
+    return n;
+}
+
+// 取出一个空闲块，耗尽时返回 NULL
+AW_INLINE void* aw_lf_freelist_alloc(aw_lf_freelist_t* fl) {
+    return (void*)aw_lf_stack_pop(&fl->free);
+}
+
+AW_INLINE void aw_lf_freelist_free(aw_lf_freelist_t* fl, void* block) {
+    aw_lf_stack_push(&fl->free, (aw_lf_node_t*)block);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_LF_STACK_H
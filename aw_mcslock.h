@@ -0,0 +1,96 @@
+#ifndef AW_MCSLOCK_H
+#define AW_MCSLOCK_H
+
+#include "aw_atomic_simple.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW MCS Lock (队列自旋锁)
+ * ============================================================================
+ * 每个等待者提供一个队列节点，通过对 tail 的一次 aw_exchange 排入队尾，
+ * 然后只在自己节点的 locked 标志上自旋。解锁时持有者只写后继者的节点，
+ * 因此一次锁交接只使一个等待者的缓存行失效，而不是向所有等待者广播。
+ *
+ * 节点由调用方提供 (通常放在栈上)，在 lock 到 unlock 期间必须保持有效，
+ * 且 unlock 时必须传入加锁时使用的同一个节点。
+ *
+ * 示例:
+ *   aw_mcs_node_t node;
+ *   aw_mcslock_lock(&lock, &node);
+ *   // ... 临界区 ...
+ *   aw_mcslock_unlock(&lock, &node);
+ */
+
+typedef struct AW_CACHELINE_ALIGN aw_mcs_node {
+    aw_atomic_ptr_t next;       // 后继等待者 (aw_mcs_node_t*)
+    aw_atomic_int_t locked;     // 1: 等待中, 0: 已被前驱移交锁
+    // 填充到整条缓存行，使每个等待者只在自己的缓存行上自旋
+    char _pad[AW_CACHELINE_SIZE - sizeof(aw_atomic_ptr_t) - sizeof(aw_atomic_int_t)];
+} aw_mcs_node_t;
+
+typedef struct {
+    aw_atomic_ptr_t tail;       // 队尾节点 (aw_mcs_node_t*)，NULL 表示空闲
+} aw_mcslock_t;
+
+#define AW_MCSLOCK_INIT { AW_ATOMIC_VAR_INIT(NULL) }
+
+AW_INLINE void aw_mcslock_init(aw_mcslock_t* lock) {
+    aw_store_rlx(&lock->tail, NULL);
+}
+
+AW_INLINE void aw_mcslock_lock(aw_mcslock_t* lock, aw_mcs_node_t* node) {
+    aw_mcs_node_t* prev;
+
+    aw_store_rlx(&node->next, NULL);
+    aw_store_rlx(&node->locked, 1);
+
+    // Release: 发布节点初始化; Acquire: 队列为空时与上一个持有者的解锁同步
+    prev = (aw_mcs_node_t*)aw_exchange(&lock->tail, (void*)node, AW_MO_ACQ_REL);
+    if (prev == NULL) {
+        return;
+    }
+
+    aw_store_rel(&prev->next, (void*)node);
+    while (aw_load_acq(&node->locked) != 0) {
+        AW_PROFILE_SPIN(1);
+        aw_cpu_pause();
+    }
+}
+
+// 仅在锁空闲时以 node 入队成功
+AW_INLINE bool aw_mcslock_try_lock(aw_mcslock_t* lock, aw_mcs_node_t* node) {
+    void* exp = NULL;
+
+    aw_store_rlx(&node->next, NULL);
+    aw_store_rlx(&node->locked, 0);
+    return aw_cas(&lock->tail, &exp, (void*)node, AW_MO_ACQUIRE, AW_MO_RELAXED);
+}
+
+AW_INLINE void aw_mcslock_unlock(aw_mcslock_t* lock, aw_mcs_node_t* node) {
+    aw_mcs_node_t* next = (aw_mcs_node_t*)aw_load_acq(&node->next);
+
+    if (next == NULL) {
+        // 没有可见的后继: 若自己仍是队尾，直接把锁置空
+        void* exp = (void*)node;
+        if (aw_cas_rel(&lock->tail, &exp, NULL)) {
+            return;
+        }
+        // 后继已完成 exchange 但还未链接到本节点，等待其写入 next
+        while ((next = (aw_mcs_node_t*)aw_load_acq(&node->next)) == NULL) {
+            AW_PROFILE_SPIN(1);
+            aw_cpu_pause();
+        }
+    }
+
+    aw_store_rel(&next->locked, 0);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_MCSLOCK_H
@@ -0,0 +1,182 @@
+#ifndef AW_MPMC_QUEUE_H
+#define AW_MPMC_QUEUE_H
+
+#include "aw_atomic_simple.h"
+#include "aw_backoff.h"
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Bounded MPMC Queue (有界多生产者/多消费者队列，Vyukov 槽位序列号方案)
+ * ============================================================================
+ * 每个槽位带有一个序列号 seq:
+ * - seq == pos        : 槽位空闲，可被下标为 pos 的生产者写入
+ * - seq == pos + 1    : 槽位已写入，可被下标为 pos 的消费者读取
+ * 读取完成后消费者把 seq 设为 pos + capacity，供下一圈的生产者使用。
+ *
+ * 生产者和消费者分别通过 aw_cas 推进各自的游标 (位于独立缓存行)，
+ * 不同槽位上的读写互不干扰，因此不会像加锁队列那样在一个锁上串行化。
+ *
+ * 元素按值内联存储在槽位中 (元素大小在初始化时给定)，入队无需额外分配内存。
+ * 存储区由调用方提供，大小为 AW_MPMC_QUEUE_BUFFER_SIZE(capacity, elem_size)
+ * 字节，且须按 size_t 对齐。
+ *
+ * 示例:
+ *   static size_t storage[AW_MPMC_QUEUE_BUFFER_SIZE(256, sizeof(job_t)) / sizeof(size_t)];
+ *   aw_mpmc_queue_t q;
+ *   aw_mpmc_queue_init(&q, storage, 256, sizeof(job_t));
+ *   aw_mpmc_queue_try_enqueue(&q, &job);
+ *   aw_mpmc_queue_dequeue(&q, &job);    // 队列空时自旋等待
+ */
+
+// 单个槽位占用的字节数: 序列号 + 元素，按 size_t 对齐
+#define AW_MPMC_QUEUE_CELL_SIZE(elem_size) \
+    ((sizeof(aw_atomic_size_t) + (elem_size) + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1))
+
+// 容量为 capacity 的队列所需的存储区字节数
+#define AW_MPMC_QUEUE_BUFFER_SIZE(capacity, elem_size) \
+    ((capacity) * AW_MPMC_QUEUE_CELL_SIZE(elem_size))
+
+typedef struct AW_CACHELINE_ALIGN {
+    // --- 只读区: 初始化后不再修改 ---
+    unsigned char* buf;
+    size_t         mask;
+    size_t         cell_size;
+    size_t         elem_size;
+    char           _pad0[AW_CACHELINE_SIZE - sizeof(unsigned char*) - 3 * sizeof(size_t)];
+
+    // --- 生产者游标 ---
+    aw_atomic_size_t enqueue_pos;
+    char             _pad1[AW_CACHELINE_SIZE - sizeof(aw_atomic_size_t)];
+
+    // --- 消费者游标 ---
+    aw_atomic_size_t dequeue_pos;
+    char             _pad2[AW_CACHELINE_SIZE - sizeof(aw_atomic_size_t)];
+} aw_mpmc_queue_t;
+
+AW_INLINE aw_atomic_size_t* _aw_mpmc_cell_seq(aw_mpmc_queue_t* q, size_t pos) {
+    return (aw_atomic_size_t*)(q->buf + (pos & q->mask) * q->cell_size);
+}
+
+AW_INLINE unsigned char* _aw_mpmc_cell_data(aw_mpmc_queue_t* q, size_t pos) {
+    return q->buf + (pos & q->mask) * q->cell_size + sizeof(aw_atomic_size_t);
+}
+
+// 初始化，capacity 不是 2 的幂 (或小于 2) 或参数非法时返回 false
+AW_INLINE bool aw_mpmc_queue_init(aw_mpmc_queue_t* q, void* buf, size_t capacity, size_t elem_size) {
+    size_t i;
+
+    if (buf == NULL || elem_size == 0 || capacity < 2 || (capacity & (capacity - 1)) != 0) {
+        return false;
+    }
+    q->buf       = (unsigned char*)buf;
+    q->mask      = capacity - 1;
+    q->cell_size = AW_MPMC_QUEUE_CELL_SIZE(elem_size);
+    q->elem_size = elem_size;
+    for (i = 0; i < capacity; i++) {
+        aw_store_rlx(_aw_mpmc_cell_seq(q, i), i);
+    }
+    aw_store_rlx(&q->enqueue_pos, 0);
+    aw_store_rlx(&q->dequeue_pos, 0);
+    return true;
+}
+
+AW_INLINE size_t aw_mpmc_queue_capacity(const aw_mpmc_queue_t* q) {
+    return q->mask + 1;
+}
+
+// ============================================================================
+// 1. 非阻塞接口
+// ============================================================================
+
+// 入队，队列满时立即返回 false
+AW_INLINE bool aw_mpmc_queue_try_enqueue(aw_mpmc_queue_t* q, const void* elem) {
+    size_t pos = aw_load_rlx(&q->enqueue_pos);
+    aw_atomic_size_t* seq_ptr;
+
+    for (;;) {
+        size_t   seq;
+        intptr_t diff;
+
+        seq_ptr = _aw_mpmc_cell_seq(q, pos);
+        seq     = aw_load_acq(seq_ptr);
+        diff    = (intptr_t)(seq - pos);
+        if (diff == 0) {
+            // 槽位空闲，尝试占用; 失败时 pos 被更新为最新游标
+            if (aw_cas(&q->enqueue_pos, &pos, pos + 1, AW_MO_RELAXED, AW_MO_RELAXED)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // 槽位仍被上一圈的元素占用: 队列已满
+            return false;
+        } else {
+            // 其他生产者已占用该位置
+            pos = aw_load_rlx(&q->enqueue_pos);
+        }
+    }
+
+    memcpy(_aw_mpmc_cell_data(q, pos), elem, q->elem_size);
+    aw_store_rel(seq_ptr, pos + 1);
+    return true;
+}
+
+// 出队，队列空时立即返回 false
+AW_INLINE bool aw_mpmc_queue_try_dequeue(aw_mpmc_queue_t* q, void* out) {
+    size_t pos = aw_load_rlx(&q->dequeue_pos);
+    aw_atomic_size_t* seq_ptr;
+
+    for (;;) {
+        size_t   seq;
+        intptr_t diff;
+
+        seq_ptr = _aw_mpmc_cell_seq(q, pos);
+        seq     = aw_load_acq(seq_ptr);
+        diff    = (intptr_t)(seq - (pos + 1));
+        if (diff == 0) {
+            if (aw_cas(&q->dequeue_pos, &pos, pos + 1, AW_MO_RELAXED, AW_MO_RELAXED)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // 槽位尚未被写入: 队列为空
+            return false;
+        } else {
+            pos = aw_load_rlx(&q->dequeue_pos);
+        }
+    }
+
+    memcpy(out, _aw_mpmc_cell_data(q, pos), q->elem_size);
+    aw_store_rel(seq_ptr, pos + q->mask + 1);
+    return true;
+}
+
+// ============================================================================
+// 2. 自旋等待接口
+// ============================================================================
+
+// 入队，队列满时以指数退避自旋等待
+AW_INLINE void aw_mpmc_queue_enqueue(aw_mpmc_queue_t* q, const void* elem) {
+    aw_backoff_t bo = AW_BACKOFF_INIT;
+
+    while (!aw_mpmc_queue_try_enqueue(q, elem)) {
+        aw_backoff_spin(&bo);
+    }
+}
+
+// 出队，队列空时以指数退避自旋等待
+AW_INLINE void aw_mpmc_queue_dequeue(aw_mpmc_queue_t* q, void* out) {
+    aw_backoff_t bo = AW_BACKOFF_INIT;
+
+    while (!aw_mpmc_queue_try_dequeue(q, out)) {
+        aw_backoff_spin(&bo);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_MPMC_QUEUE_H
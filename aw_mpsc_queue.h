@@ -0,0 +1,129 @@
+#ifndef AW_MPSC_QUEUE_H
+#define AW_MPSC_QUEUE_H
+
+#include "aw_atomic_simple.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Intrusive MPSC Queue (侵入式无界多生产者/单消费者队列)
+ * ============================================================================
+ * 适用于 actor 邮箱: 任意线程投递，一个线程消费。
+ * - 队列节点 aw_mpsc_node_t 嵌入用户结构体，入队路径无需分配内存，
+ *   出队后可用 AW_CONTAINER_OF 取回用户结构体。
+ * - 生产者: 一次 aw_exchange 交换 tail，再以 Release 写入前驱的 next。
+ * - 消费者: 只做 Load/Store，仅在队列恰好只剩最后一个元素时需要把内部的
+ *   stub 节点重新入队 (一次 aw_exchange)。
+ *
+ * 生产者完成 exchange 但尚未链接前驱时，消费者看到的队列是暂时断开的，
+ * 此时 aw_mpsc_queue_pop 返回 NULL，稍后重试即可。
+ *
+ * 队列内部包含 stub 节点，初始化后不可移动或拷贝。
+ *
+ * 示例:
+ *   typedef struct { aw_mpsc_node_t node; int payload; } msg_t;
+ *   // 生产者
+ *   aw_mpsc_queue_push(&q, &msg->node);
+ *   // 消费者
+ *   aw_mpsc_node_t* n = aw_mpsc_queue_pop(&q);
+ *   if (n) { msg_t* m = AW_CONTAINER_OF(n, msg_t, node); ... }
+ */
+
+typedef struct aw_mpsc_node {
+    aw_atomic_ptr_t next;       // aw_mpsc_node_t*
+} aw_mpsc_node_t;
+
+typedef struct AW_CACHELINE_ALIGN {
+    // --- 生产者共享 ---
+    aw_atomic_ptr_t  tail;      // aw_mpsc_node_t*
+    char             _pad0[AW_CACHELINE_SIZE - sizeof(aw_atomic_ptr_t)];
+
+    // --- 消费者独占 ---
+    aw_mpsc_node_t*  head;
+    aw_mpsc_node_t   stub;
+} aw_mpsc_queue_t;
+
+AW_INLINE void aw_mpsc_queue_init(aw_mpsc_queue_t* q) {
+    aw_store_rlx(&q->stub.next, NULL);
+    q->head = &q->stub;
+    aw_store_rlx(&q->tail, (void*)&q->stub);
+}
+
+// 在构建批量链表时链接两个节点 (链表发布前调用，无需同步)
+AW_INLINE void aw_mpsc_node_link(aw_mpsc_node_t* node, aw_mpsc_node_t* next) {
+    aw_store_rlx(&node->next, (void*)next);
+}
+
+// ============================================================================
+// 1. 生产者接口 (任意线程)
+// ============================================================================
+
+// 把已通过 aw_mpsc_node_link 链接好的 first..last 整条链表一次性入队
+AW_INLINE void aw_mpsc_queue_push_batch(aw_mpsc_queue_t* q, aw_mpsc_node_t* first, aw_mpsc_node_t* last) {
+    aw_mpsc_node_t* prev;
+
+    aw_store_rlx(&last->next, NULL);
+    prev = (aw_mpsc_node_t*)aw_exchange(&q->tail, (void*)last, AW_MO_ACQ_REL);
+    // Release: 发布整条链表的内容
+    aw_store_rel(&prev->next, (void*)first);
+}
+
+AW_INLINE void aw_mpsc_queue_push(aw_mpsc_queue_t* q, aw_mpsc_node_t* node) {
+    aw_mpsc_queue_push_batch(q, node, node);
+}
+
+// ============================================================================
+// 2. 消费者接口 (仅限单一线程)
+// ============================================================================
+
+// 出队，队列为空或生产者正在链接时返回 NULL
+AW_INLINE aw_mpsc_node_t* aw_mpsc_queue_pop(aw_mpsc_queue_t* q) {
+    aw_mpsc_node_t* head = q->head;
+    aw_mpsc_node_t* next = (aw_mpsc_node_t*)aw_load_acq(&head->next);
+
+    // 跳过 stub 节点
+    if (head == &q->stub) {
+        if (next == NULL) {
+            return NULL;
+        }
+        q->head = next;
+        head = next;
+        next = (aw_mpsc_node_t*)aw_load_acq(&head->next);
+    }
+
+    if (next != NULL) {
+        q->head = next;
+        return head;
+    }
+
+    // head 没有后继: 若 head 不是队尾，说明有生产者尚未完成链接
+    if ((aw_mpsc_node_t*)aw_load_acq(&q->tail) != head) {
+        return NULL;
+    }
+
+    // head 是最后一个元素: 重新入队 stub，使 head 可以被安全取走
+    aw_mpsc_queue_push(q, &q->stub);
+    next = (aw_mpsc_node_t*)aw_load_acq(&head->next);
+    if (next != NULL) {
+        q->head = next;
+        return head;
+    }
+    return NULL;
+}
+
+// 队列是否为空 (仅消费者线程调用时结果可靠)
+AW_INLINE bool aw_mpsc_queue_empty(aw_mpsc_queue_t* q) {
+    aw_mpsc_node_t* head = q->head;
+    return head == &q->stub &&
+           aw_load_acq(&head->next) == NULL &&
+           (aw_mpsc_node_t*)aw_load_acq(&q->tail) == head;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_MPSC_QUEUE_H
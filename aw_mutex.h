@@ -0,0 +1,101 @@
+#ifndef AW_MUTEX_H
+#define AW_MUTEX_H
+
+#include "aw_wait.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Mutex (自适应自旋 + 挂起的三态互斥锁)
+ * ============================================================================
+ * 锁字的三种状态:
+ *   0: 未加锁
+ *   1: 已加锁，没有等待者
+ *   2: 已加锁，可能有等待者 (解锁时需要唤醒)
+ *
+ * - 快速路径: 加锁一次 aw_cas_acq (0 -> 1)，解锁一次 aw_exchange (-> 0)；
+ *   只有交换出的旧值为 2 时才调用 aw_notify_one。
+ * - 慢速路径: 先自旋等待锁被释放，自旋上限为估计值的 2 倍加 10。自旋拿到锁时
+ *   估计值向实际自旋次数 (近似持有时间) 滑动；超过上限仍未拿到锁时估计值衰减，
+ *   随后把锁字置为 2 并通过 aw_wait_park 直接挂起 (Linux 上为 futex)，
+ *   不再经过 aw_wait 自带的自旋阶段。
+ *
+ * 临界区很短时几乎总在自旋阶段拿到锁，避免了系统调用；持有时间较长时自旋上限
+ * 会自动收缩到最小值，等待者很快挂起，不再浪费 CPU。
+ */
+
+// 自旋上限的上界 (单位: 次 aw_cpu_pause)
+#ifndef AW_MUTEX_SPIN_MAX
+#define AW_MUTEX_SPIN_MAX 200
+#endif
+
+typedef struct {
+    aw_atomic_int_t state;      // 0 / 1 / 2
+    aw_atomic_int_t spin_est;   // 自旋成功时所需次数的滑动平均，挂起时衰减
+} aw_mutex_t;
+
+#define AW_MUTEX_INIT { AW_ATOMIC_VAR_INIT(0), AW_ATOMIC_VAR_INIT(0) }
+
+AW_INLINE void aw_mutex_init(aw_mutex_t* m) {
+    aw_store_rlx(&m->state, 0);
+    aw_store_rlx(&m->spin_est, 0);
+}
+
+AW_INLINE bool aw_mutex_try_lock(aw_mutex_t* m) {
+    int c = 0;
+    return aw_cas_acq(&m->state, &c, 1);
+}
+
+AW_INLINE void _aw_mutex_lock_slow(aw_mutex_t* m) {
+    int est = aw_load_rlx(&m->spin_est);
+    int max = est * 2 + 10;
+    int cnt = 0;
+    int c;
+
+    if (max > AW_MUTEX_SPIN_MAX) {
+        max = AW_MUTEX_SPIN_MAX;
+    }
+
+    // 1. 自适应自旋 (只读观察，锁空闲时才发起 CAS)
+    for (; cnt < max; cnt++) {
+        if (aw_load_rlx(&m->state) == 0 && aw_mutex_try_lock(m)) {
+            // 多个线程并发更新估计值时可能丢失一次更新，对启发式无影响
+            aw_store_rlx(&m->spin_est, est + (cnt - est) / 8);
+            return;
+        }
+        AW_PROFILE_SPIN(1);
+        aw_cpu_pause();
+    }
+    // 自旋没有拿到锁说明持有时间超过了当前上限，估计值按 1/8 衰减 (至少减 1)，
+    // 持续需要挂起时上限逐步收缩到最小值 10
+    aw_store_rlx(&m->spin_est, est > 0 ? est - est / 8 - 1 : 0);
+
+    // 2. 挂起: 置为 "有等待者" 状态，交换出 0 说明在此期间拿到了锁
+    c = aw_exchange(&m->state, 2, AW_MO_ACQUIRE);
+    while (c != 0) {
+        aw_wait_park(&m->state, 2, AW_MO_RELAXED);
+        c = aw_exchange(&m->state, 2, AW_MO_ACQUIRE);
+    }
+}
+
+AW_INLINE void aw_mutex_lock(aw_mutex_t* m) {
+    int c = 0;
+    if (!aw_cas_acq(&m->state, &c, 1)) {
+        _aw_mutex_lock_slow(m);
+    }
+}
+
+AW_INLINE void aw_mutex_unlock(aw_mutex_t* m) {
+    if (aw_exchange(&m->state, 0, AW_MO_RELEASE) == 2) {
+        aw_notify_one(&m->state);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_MUTEX_H
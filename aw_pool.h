@@ -0,0 +1,304 @@
+#ifndef AW_POOL_H
+#define AW_POOL_H
+
+#include "aw_lf_stack.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Object Pool (定长对象池，线程本地缓存 + 全局无锁批次栈)
+ * ============================================================================
+ * 调用方提供的 slab 内存被切分成 block_size 大小的块，按 AW_POOL_BATCH 个一批
+ * 挂在全局无锁栈 (aw_lf_stack_t) 上。每个线程持有一个 aw_pool_cache_t:
+ *
+ * - 分配 / 释放只操作本线程缓存中的普通单链表，快速路径没有任何原子操作
+ *   (命中计数在本地累计，每 AW_POOL_BATCH 次命中才汇总一次);
+ * - 缓存为空时从全局栈弹出一整批 (一次 CAS);
+ * - 缓存超过 2 * AW_POOL_BATCH 个块时把一批压回全局栈 (一次 CAS)。
+ *
+ * 没有缓存的线程 (或释放别的线程分配的对象时不想污染本地缓存) 可以用
+ * aw_pool_free_remote 把单个块压入单独的远程栈，计入 remote_frees 统计。
+ * 补充时先以一次 aw_lf_stack_pop_all 整体取走远程栈，超出 2 * AW_POOL_BATCH
+ * 的部分再按批归还全局栈，远程释放的块不会以单块批次的形式被逐个取回。
+ *
+ * slab 内存在池的整个生命周期内都不能归还 (全局栈 pop 可能读取已被复用的块)。
+ * 线程退出前应调用 aw_pool_cache_flush 交还缓存中的块。
+ *
+ * 示例:
+ *   static aw_pool_t msg_pool;
+ *   aw_pool_init(&msg_pool, sizeof(msg_t));
+ *   aw_pool_add_slab(&msg_pool, slab_mem, slab_bytes);
+ *
+ *   // 每个线程
+ *   aw_pool_cache_t cache;
+ *   aw_pool_cache_init(&cache, &msg_pool);
+ *   msg_t* m = (msg_t*)aw_pool_alloc(&cache);
+ *   aw_pool_free(&cache, m);
+ *   aw_pool_cache_flush(&cache);
+ */
+
+#ifndef AW_POOL_BATCH
+#define AW_POOL_BATCH 32
+#endif
+
+// 空闲块的头部布局 (块被分配出去后整个块归用户使用)
+typedef struct aw_pool_block {
+    aw_lf_node_t          node;     // 全局栈中批次之间的链接 (仅批次头使用)
+    struct aw_pool_block* next;     // 批次内 / 本地缓存内的链接
+    size_t                count;    // 批次头: 本批的块数
+} aw_pool_block_t;
+
+typedef struct {
+    unsigned long long hits;            // 由本地缓存直接满足的分配
+    unsigned long long refills;         // 从全局栈取批次的次数
+    unsigned long long drains;          // 向全局栈归还批次的次数
+    unsigned long long remote_frees;    // aw_pool_free_remote 的次数
+} aw_pool_stats_t;
+
+typedef struct {
+    aw_lf_stack_t      batches;         // 全局批次栈
+    aw_lf_stack_t      remote;          // aw_pool_free_remote 释放的单个块
+    size_t             block_size;
+
+    // 统计只在慢速路径上更新，与批次栈分处不同缓存行
+    struct AW_CACHELINE_ALIGN {
+        aw_atomic_ullong_t hits;
+        aw_atomic_ullong_t refills;
+        aw_atomic_ullong_t drains;
+        aw_atomic_ullong_t remote_frees;
+    } stats;
+} aw_pool_t;
+
+// 线程本地缓存，只能由持有它的线程访问
+typedef struct AW_CACHELINE_ALIGN {
+    aw_pool_t*         pool;
+    aw_pool_block_t*   head;
+    size_t             count;
+    unsigned long long hits;            // 尚未汇总到池统计中的命中次数 (< AW_POOL_BATCH)
+} aw_pool_cache_t;
+
+// ============================================================================
+// 1. 池
+// ============================================================================
+
+// block_size 会被向上取整到指针大小的整数倍，且不小于 aw_pool_block_t
+AW_INLINE void aw_pool_init(aw_pool_t* pool, size_t block_size) {
+    if (block_size < sizeof(aw_pool_block_t)) {
+        block_size = sizeof(aw_pool_block_t);
+    }
+    pool->block_size = (block_size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+    aw_lf_stack_init(&pool->batches);
+    aw_lf_stack_init(&pool->remote);
+    aw_store_rlx(&pool->stats.hits, 0ULL);
+    aw_store_rlx(&pool->stats.refills, 0ULL);
+    aw_store_rlx(&pool->stats.drains, 0ULL);
+    aw_store_rlx(&pool->stats.remote_frees, 0ULL);
+}
+
+// 把 first 开始的 count 个已链接块作为一批压入全局栈
+AW_INLINE void _aw_pool_push_batch(aw_pool_t* pool, aw_pool_block_t* first, size_t count) {
+    first->count = count;
+    aw_lf_stack_push(&pool->batches, &first->node);
+}
+
+// 切分一块 slab 并加入池，返回切分出的块数。可在运行期间随时调用
+AW_INLINE size_t aw_pool_add_slab(aw_pool_t* pool, void* mem, size_t bytes) {
+    unsigned char* p = (unsigned char*)mem;
+    aw_pool_block_t* first = NULL;
+    aw_pool_block_t* prev = NULL;
+    size_t in_batch = 0;
+    size_t total = 0;
+
+    while (bytes >= pool->block_size) {
+        aw_pool_block_t* b = (aw_pool_block_t*)p;
+
+        b->next = NULL;
+        if (prev != NULL) {
+            prev->next = b;
+        } else {
+            first = b;
+        }
+        prev = b;
+        if (++in_batch == AW_POOL_BATCH) {
+            _aw_pool_push_batch(pool, first, in_batch);
+            prev = NULL;
+            in_batch = 0;
+        }
+        p     += pool->block_size;
+        bytes -= pool->block_size;
+        total++;
+    }
+    if (in_batch != 0) {
+        _aw_pool_push_batch(pool, first, in_batch);
+    }
+    return total;
+}
+
+// 没有本地缓存时归还单个块 (压入远程栈，由下一次补充整体取走)
+AW_INLINE void aw_pool_free_remote(aw_pool_t* pool, void* ptr) {
+    aw_pool_block_t* b = (aw_pool_block_t*)ptr;
+
+    aw_lf_stack_push(&pool->remote, &b->node);
+    aw_inc_rlx(&pool->stats.remote_frees);
+}
+
+// 统计快照。每个缓存最多还有 AW_POOL_BATCH - 1 次命中尚未汇总到 hits 中
+AW_INLINE void aw_pool_get_stats(aw_pool_t* pool, aw_pool_stats_t* out) {
+    out->hits         = aw_load_rlx(&pool->stats.hits);
+    out->refills      = aw_load_rlx(&pool->stats.refills);
+    out->drains       = aw_load_rlx(&pool->stats.drains);
+    out->remote_frees = aw_load_rlx(&pool->stats.remote_frees);
+}
+
+// ============================================================================
+// 2. 线程本地缓存
+// ============================================================================
+
+AW_INLINE void aw_pool_cache_init(aw_pool_cache_t* c, aw_pool_t* pool) {
+    c->pool  = pool;
+    c->head  = NULL;
+    c->count = 0;
+    c->hits  = 0;
+}
+
+AW_INLINE void _aw_pool_publish_hits(aw_pool_cache_t* c) {
+    if (c->hits != 0) {
+        aw_faa_rlx(&c->pool->stats.hits, c->hits);
+        c->hits = 0;
+    }
+}
+
+// 整体取走远程栈，本地缓存为空时调用；远程栈为空时返回 false
+AW_INLINE bool _aw_pool_take_remote(aw_pool_cache_t* c) {
+    aw_pool_block_t** tail = &c->head;
+    aw_pool_block_t* first = NULL;      // 超出部分正在组装的批次
+    aw_pool_block_t* last = NULL;
+    size_t in_batch = 0;
+    aw_lf_node_t* node;
+
+    if (aw_lf_stack_empty(&c->pool->remote)) {
+        return false;
+    }
+    node = aw_lf_stack_pop_all(&c->pool->remote);
+    if (node == NULL) {
+        return false;
+    }
+    // 栈顶是最近释放 (最可能还在 CPU 缓存中) 的块: 前 2 * AW_POOL_BATCH 个按原
+    // 顺序留在本地，其余按批交还全局栈，其他线程仍能取到
+    while (node != NULL) {
+        aw_pool_block_t* b = AW_CONTAINER_OF(node, aw_pool_block_t, node);
+
+        node    = (aw_lf_node_t*)aw_load_rlx(&node->next);
+        b->next = NULL;
+        if (c->count < 2 * AW_POOL_BATCH) {
+            *tail = b;
+            tail  = &b->next;
+            c->count++;
+            continue;
+        }
+        if (first == NULL) {
+            first = b;
+        } else {
+            last->next = b;
+        }
+        last = b;
+        if (++in_batch == AW_POOL_BATCH) {
+            _aw_pool_push_batch(c->pool, first, in_batch);
+            aw_inc_rlx(&c->pool->stats.drains);
+            first    = NULL;
+            in_batch = 0;
+        }
+    }
+    if (in_batch != 0) {
+        _aw_pool_push_batch(c->pool, first, in_batch);
+        aw_inc_rlx(&c->pool->stats.drains);
+    }
+    return true;
+}
+
+// 先取远程栈，再从全局栈取一批，两者都为空时返回 false
+AW_INLINE bool _aw_pool_refill(aw_pool_cache_t* c) {
+    if (!_aw_pool_take_remote(c)) {
+        aw_lf_node_t* node = aw_lf_stack_pop(&c->pool->batches);
+        aw_pool_block_t* b;
+
+        if (node == NULL) {
+            return false;
+        }
+        b = AW_CONTAINER_OF(node, aw_pool_block_t, node);
+        c->head  = b;
+        c->count = b->count;
+    }
+    aw_inc_rlx(&c->pool->stats.refills);
+    _aw_pool_publish_hits(c);
+    return true;
+}
+
+// 把缓存头部的 AW_POOL_BATCH 个块作为一批归还
+AW_INLINE void _aw_pool_drain(aw_pool_cache_t* c) {
+    aw_pool_block_t* first = c->head;
+    aw_pool_block_t* last = first;
+    size_t i;
+
+    for (i = 1; i < AW_POOL_BATCH; i++) {
+        last = last->next;
+    }
+    c->head  = last->next;
+    c->count -= AW_POOL_BATCH;
+    last->next = NULL;
+    _aw_pool_push_batch(c->pool, first, AW_POOL_BATCH);
+    aw_inc_rlx(&c->pool->stats.drains);
+    _aw_pool_publish_hits(c);
+}
+
+// 分配一个块，池耗尽时返回 NULL
+AW_INLINE void* aw_pool_alloc(aw_pool_cache_t* c) {
+    aw_pool_block_t* b = c->head;
+
+    if (b != NULL) {
+        // 只有补充与归还时才汇总的话，一直命中的缓存会让 hits 无限滞后
+        if (++c->hits == AW_POOL_BATCH) {
+            _aw_pool_publish_hits(c);
+        }
+    } else {
+        if (!_aw_pool_refill(c)) {
+            return NULL;
+        }
+        b = c->head;
+    }
+    c->head = b->next;
+    c->count--;
+    return (void*)b;
+}
+
+AW_INLINE void aw_pool_free(aw_pool_cache_t* c, void* ptr) {
+    aw_pool_block_t* b = (aw_pool_block_t*)ptr;
+
+    b->next = c->head;
+    c->head = b;
+    if (++c->count > 2 * AW_POOL_BATCH) {
+        _aw_pool_drain(c);
+    }
+}
+
+// 把缓存中的所有块交还全局栈 (线程退出前调用)
+AW_INLINE void aw_pool_cache_flush(aw_pool_cache_t* c) {
+    while (c->count >= AW_POOL_BATCH) {
+        _aw_pool_drain(c);
+    }
+    if (c->count != 0) {
+        _aw_pool_push_batch(c->pool, c->head, c->count);
+        c->head  = NULL;
+        c->count = 0;
+    }
+    _aw_pool_publish_hits(c);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_POOL_H
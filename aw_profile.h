@@ -0,0 +1,300 @@
+// 启用 AW_ATOMIC_PROFILE 时本文件依赖 aw_atomic.h 中的后端实现，由 aw_atomic.h
+// 在定义公开接口之前包含；单独包含本文件时先转去包含 aw_atomic.h
+#ifndef AW_ATOMICS_H
+#include "aw_atomic.h"
+#endif
+
+#ifndef AW_PROFILE_H
+#define AW_PROFILE_H
+
+#ifndef AW_ATOMIC_PROFILE
+    // 未启用时报告接口为空操作，调用方无需按模式区分
+    #define aw_profile_report(out, top_n) ((void)0)
+    #define aw_profile_reset()            ((void)0)
+#else
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Atomic Profile (按调用点统计原子操作竞争)
+ * ============================================================================
+ * 编译时定义 AW_ATOMIC_PROFILE 启用 (所有翻译单元需一致)，未定义时本文件不参与
+ * 编译，aw_cas 等宏直接映射到后端实现，没有任何额外开销。
+ *
+ * 启用后按 __FILE__/__LINE__ 记录:
+ * - aw_cas / aw_cas_weak: 成功与失败次数 (失败即一次重试);
+ * - aw_exchange: 调用次数;
+ * - aw_backoff_spin: 退避次数与累计 pause 次数;
+ * - 库内直接调用 aw_cpu_pause() 的等待循环 (ticket/MCS 锁、seqlock、读写锁写者
+ *   等待读者退出、互斥锁自旋阶段、自旋锁只读自旋、aw_wait 自旋阶段、任务 join):
+ *   经 AW_PROFILE_SPIN 记录等待轮数 (spins) 与 pause 次数。
+ *
+ * 每个线程首次记录时分配一张站点表 (AW_PROFILE_SITES 个槽位) 并挂入全局链表，
+ * 记录过程只写本线程的表，不引入额外的共享缓存行。aw_profile_report 遍历所有
+ * 表、合并相同调用点后按 CAS 失败率降序输出。线程退出后其表仍然保留，计数
+ * 不会丢失 (表本身也不会释放)。
+ *
+ * 注意: 库内部内联函数中的调用点 (如 aw_spinlock_lock 中的 aw_cas) 记录为
+ * 对应头文件的行号，所有实例合并统计。用户代码中自己写的 aw_cpu_pause() 循环
+ * 不会自动计入，可在循环体内加 AW_PROFILE_SPIN(1)。
+ *
+ * 示例:
+ *   gcc -DAW_ATOMIC_PROFILE ...
+ *   aw_profile_report(stderr, 20);
+ */
+
+#ifndef AW_PROFILE_SITES
+#define AW_PROFILE_SITES 512        // 每线程站点表的槽位数 (2 的幂)
+#endif
+
+typedef struct {
+    aw_atomic_int_t    line;        // 0: 空槽位；写入 file 后再以 Release 发布
+    const char*        file;
+    aw_atomic_ullong_t cas_ok;
+    aw_atomic_ullong_t cas_fail;
+    aw_atomic_ullong_t exchanges;
+    aw_atomic_ullong_t spins;
+    aw_atomic_ullong_t pauses;
+} _aw_prof_site_t;
+
+typedef struct _aw_prof_table {
+    struct _aw_prof_table* next;
+    aw_atomic_ullong_t     dropped;     // 表满后丢弃的记录数
+    _aw_prof_site_t        sites[AW_PROFILE_SITES];
+} _aw_prof_table_t;
+
+// 合并后的单个调用点统计
+typedef struct {
+    const char*        file;
+    int                line;
+    unsigned long long cas_ok;
+    unsigned long long cas_fail;
+    unsigned long long exchanges;
+    unsigned long long spins;
+    unsigned long long pauses;
+} aw_profile_site_t;
+
+// 全局表链表在所有编译单元之间共享
+#if defined(AW_COMPILER_MSVC)
+    __declspec(selectany) aw_atomic_ptr_t _aw_prof_tables;
+#else
+    __port_weak aw_atomic_ptr_t _aw_prof_tables;
+#endif
+
+// ============================================================================
+// 1. 记录
+// ============================================================================
+
+// 计数只由所属线程写入，用 Relaxed 读写代替 RMW
+AW_INLINE void _aw_prof_bump(aw_atomic_ullong_t* c, unsigned long long n) {
+    aw_store(c, aw_load(c, AW_MO_RELAXED) + n, AW_MO_RELAXED);
+}
+
+AW_INLINE _aw_prof_table_t* _aw_prof_table(void) {
+    static AW_THREAD_LOCAL _aw_prof_table_t* table;
+    void* head;
+
+    if (table != NULL) {
+        return table;
+    }
+    table = (_aw_prof_table_t*)calloc(1, sizeof(_aw_prof_table_t));
+    if (table == NULL) {
+        return NULL;
+    }
+    head = (void*)aw_load(&_aw_prof_tables, AW_MO_RELAXED);
+    do {
+        table->next = (_aw_prof_table_t*)head;
+    } while (!_aw_cas_weak_raw(&_aw_prof_tables, &head, (void*)table, AW_MO_RELEASE, AW_MO_RELAXED));
+    return table;
+}
+
+AW_INLINE _aw_prof_site_t* _aw_prof_site(const char* file, int line) {
+    _aw_prof_table_t* t = _aw_prof_table();
+    uintptr_t h = ((uintptr_t)file >> 3) ^ ((uintptr_t)line * (uintptr_t)0x9E3779B1u);
+    size_t i;
+
+    if (t == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < AW_PROFILE_SITES; i++) {
+        _aw_prof_site_t* s = &t->sites[(h + i) & (AW_PROFILE_SITES - 1)];
+        int l = aw_load(&s->line, AW_MO_RELAXED);
+
+        if (l == line && s->file == file) {
+            return s;
+        }
+        if (l == 0) {
+            s->file = file;
+            aw_store(&s->line, line, AW_MO_RELEASE);
+            return s;
+        }
+    }
+    _aw_prof_bump(&t->dropped, 1);
+    return NULL;
+}
+
+AW_INLINE bool _aw_prof_cas(bool ok, const char* file, int line) {
+    _aw_prof_site_t* s = _aw_prof_site(file, line);
+
+    if (s != NULL) {
+        _aw_prof_bump(ok ? &s->cas_ok : &s->cas_fail, 1);
+    }
+    return ok;
+}
+
+AW_INLINE void _aw_prof_exchange(const char* file, int line) {
+    _aw_prof_site_t* s = _aw_prof_site(file, line);
+
+    if (s != NULL) {
+        _aw_prof_bump(&s->exchanges, 1);
+    }
+}
+
+AW_INLINE void _aw_prof_spin(unsigned int pauses, const char* file, int line) {
+    _aw_prof_site_t* s = _aw_prof_site(file, line);
+
+    if (s != NULL) {
+        _aw_prof_bump(&s->spins, 1);
+        _aw_prof_bump(&s->pauses, pauses);
+    }
+}
+
+// ============================================================================
+// 2. 汇总与报告
+// ============================================================================
+
+AW_INLINE int _aw_prof_cmp_site(const void* a, const void* b) {
+    const aw_profile_site_t* x = (const aw_profile_site_t*)a;
+    const aw_profile_site_t* y = (const aw_profile_site_t*)b;
+    int c = strcmp(x->file, y->file);
+
+    return c != 0 ? c : (x->line > y->line) - (x->line < y->line);
+}
+
+AW_INLINE double _aw_prof_fail_rate(const aw_profile_site_t* s) {
+    unsigned long long total = s->cas_ok + s->cas_fail;
+    return total != 0 ? (double)s->cas_fail / (double)total : 0.0;
+}
+
+// 失败率降序，其次按累计 pause 次数降序
+AW_INLINE int _aw_prof_cmp_rate(const void* a, const void* b) {
+    const aw_profile_site_t* x = (const aw_profile_site_t*)a;
+    const aw_profile_site_t* y = (const aw_profile_site_t*)b;
+    double rx = _aw_prof_fail_rate(x);
+    double ry = _aw_prof_fail_rate(y);
+
+    if (rx != ry) {
+        return rx < ry ? 1 : -1;
+    }
+    return (x->pauses < y->pauses) - (x->pauses > y->pauses);
+}
+
+/*
+ * 合并所有线程的站点表，按失败率降序排列。
+ * 返回 malloc 分配的数组 (调用方 free)，*count 为调用点个数，*dropped 为因表满
+ * 丢弃的记录数 (可为 NULL)。其他线程仍在记录时得到的是近似快照。
+ */
+AW_INLINE aw_profile_site_t* aw_profile_collect(size_t* count, unsigned long long* dropped) {
+    _aw_prof_table_t* t;
+    aw_profile_site_t* out;
+    size_t n = 0, cap = 0, i, m;
+    unsigned long long lost = 0;
+
+    for (t = (_aw_prof_table_t*)aw_load(&_aw_prof_tables, AW_MO_ACQUIRE); t != NULL; t = t->next) {
+        cap += AW_PROFILE_SITES;
+    }
+    out = (aw_profile_site_t*)malloc((cap != 0 ? cap : 1) * sizeof(aw_profile_site_t));
+    if (out == NULL) {
+        *count = 0;
+        return NULL;
+    }
+    for (t = (_aw_prof_table_t*)aw_load(&_aw_prof_tables, AW_MO_ACQUIRE); t != NULL && n < cap; t = t->next) {
+        lost += aw_load(&t->dropped, AW_MO_RELAXED);
+        for (i = 0; i < AW_PROFILE_SITES && n < cap; i++) {
+            _aw_prof_site_t* s = &t->sites[i];
+            int line = aw_load(&s->line, AW_MO_ACQUIRE);
+
+            if (line == 0) {
+                continue;
+            }
+            out[n].file      = s->file;
+            out[n].line      = line;
+            out[n].cas_ok    = aw_load(&s->cas_ok, AW_MO_RELAXED);
+            out[n].cas_fail  = aw_load(&s->cas_fail, AW_MO_RELAXED);
+            out[n].exchanges = aw_load(&s->exchanges, AW_MO_RELAXED);
+            out[n].spins     = aw_load(&s->spins, AW_MO_RELAXED);
+            out[n].pauses    = aw_load(&s->pauses, AW_MO_RELAXED);
+            n++;
+        }
+    }
+
+    // 合并不同线程 (及不同编译单元) 中的同一调用点
+    qsort(out, n, sizeof(aw_profile_site_t), _aw_prof_cmp_site);
+    for (i = 0, m = 0; i < n; i++) {
+        if (m != 0 && _aw_prof_cmp_site(&out[m - 1], &out[i]) == 0) {
+            out[m - 1].cas_ok    += out[i].cas_ok;
+            out[m - 1].cas_fail  += out[i].cas_fail;
+            out[m - 1].exchanges += out[i].exchanges;
+            out[m - 1].spins     += out[i].spins;
+            out[m - 1].pauses    += out[i].pauses;
+        } else {
+            out[m++] = out[i];
+        }
+    }
+    qsort(out, m, sizeof(aw_profile_site_t), _aw_prof_cmp_rate);
+
+    *count = m;
+    if (dropped != NULL) {
+        *dropped = lost;
+    }
+    return out;
+}
+
+// 打印竞争最激烈的 top_n 个调用点 (top_n 为 0 时全部打印)
+AW_INLINE void aw_profile_report(FILE* out, size_t top_n) {
+    unsigned long long dropped = 0;
+    size_t n = 0, i;
+    aw_profile_site_t* sites = aw_profile_collect(&n, &dropped);
+
+    if (top_n == 0 || top_n > n) {
+        top_n = n;
+    }
+    fprintf(out, "aw_atomic profile: %lu sites, %llu dropped\n", (unsigned long)n, dropped);
+    fprintf(out, "%7s %14s %14s %12s %12s %14s  %s\n",
+            "fail%", "cas_ok", "cas_fail", "exchange", "spins", "pauses", "site");
+    for (i = 0; i < top_n; i++) {
+        fprintf(out, "%6.2f%% %14llu %14llu %12llu %12llu %14llu  %s:%d\n",
+                _aw_prof_fail_rate(&sites[i]) * 100.0,
+                sites[i].cas_ok, sites[i].cas_fail, sites[i].exchanges,
+                sites[i].spins, sites[i].pauses, sites[i].file, sites[i].line);
+    }
+    free(sites);
+}
+
+// 清零所有计数 (与正在记录的线程并发时结果近似)
+AW_INLINE void aw_profile_reset(void) {
+    _aw_prof_table_t* t;
+    size_t i;
+
+    for (t = (_aw_prof_table_t*)aw_load(&_aw_prof_tables, AW_MO_ACQUIRE); t != NULL; t = t->next) {
+        aw_store(&t->dropped, 0ULL, AW_MO_RELAXED);
+        for (i = 0; i < AW_PROFILE_SITES; i++) {
+            aw_store(&t->sites[i].cas_ok, 0ULL, AW_MO_RELAXED);
+            aw_store(&t->sites[i].cas_fail, 0ULL, AW_MO_RELAXED);
+            aw_store(&t->sites[i].exchanges, 0ULL, AW_MO_RELAXED);
+            aw_store(&t->sites[i].spins, 0ULL, AW_MO_RELAXED);
+            aw_store(&t->sites[i].pauses, 0ULL, AW_MO_RELAXED);
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_ATOMIC_PROFILE
+
+#endif // AW_PROFILE_H
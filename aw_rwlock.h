@@ -0,0 +1,155 @@
+#ifndef AW_RWLOCK_H
+#define AW_RWLOCK_H
+
+#include "aw_thread.h"
+#include "aw_backoff.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Reader-Writer Lock (分布式读者槽位的读写锁，写者优先)
+ * ============================================================================
+ * 读者计数不再集中在一个字上，而是分散到 AW_RWLOCK_SLOTS 个按缓存行对齐的
+ * 槽位中，每个线程按 aw_thread_hint() 固定使用其中一个。读加锁只对本线程的
+ * 槽位做一次 RMW，再读取一次 (通常处于共享状态的) 写者标志，读者之间不再
+ * 争夺同一条缓存行。
+ *
+ * - 读者: 槽位 +1 (SeqCst) -> 检查写者标志；若有写者则撤销 -1 并等待写者离开。
+ * - 写者: CAS 抢占写者标志 (写者之间互斥) -> 逐个等待所有槽位归零。
+ * - 写者优先: 写者标志一旦置位，新来的读者会让路，写者不会被持续的读者饿死。
+ *
+ * 定义 AW_RWLOCK_USE_CPU 后在支持的平台上按当前 CPU 编号选择槽位。
+ * 读加锁返回所用槽位的编号，解锁时必须原样传回 (线程可能已迁移到别的 CPU)。
+ *
+ * 示例:
+ *   static aw_rwlock_t lock = AW_RWLOCK_INIT;
+ *   int slot = aw_rwlock_read_lock(&lock);
+ *   ... 只读访问 ...
+ *   aw_rwlock_read_unlock(&lock, slot);
+ */
+
+#ifndef AW_RWLOCK_SLOTS
+#define AW_RWLOCK_SLOTS 16
+#endif
+
+typedef struct {
+    aw_padded_atomic_int_t  writer;                     // 1: 有写者持有或正在等待读者退出
+    aw_padded_atomic_long_t readers[AW_RWLOCK_SLOTS];   // 各槽位内的读者数
+} aw_rwlock_t;
+
+// 静态初始化 (全部为 0)，未列出的槽位按零初始化
+#define AW_RWLOCK_INIT { { AW_ATOMIC_VAR_INIT(0), { 0 } }, { { AW_ATOMIC_VAR_INIT(0), { 0 } } } }
+
+AW_INLINE void aw_rwlock_init(aw_rwlock_t* l) {
+    int i;
+
+    aw_store_rlx(&l->writer.value, 0);
+    for (i = 0; i < AW_RWLOCK_SLOTS; i++) {
+        aw_store_rlx(&l->readers[i].value, 0);
+    }
+}
+
+// ============================================================================
+// 1. 读者
+// ============================================================================
+
+// 尝试读加锁，成功时返回槽位编号，有写者时返回 -1
+AW_INLINE int aw_rwlock_try_read_lock(aw_rwlock_t* l) {
+#if defined(AW_RWLOCK_USE_CPU) && defined(AW_HAS_CPU_ID)
+    int cpu = aw_cpu_id();
+    unsigned int idx = cpu >= 0 ? (unsigned int)cpu : aw_thread_hint();
+#else
+    unsigned int idx = aw_thread_hint();
+#endif
+    int slot = (int)(idx % AW_RWLOCK_SLOTS);
+
+    // SeqCst: 槽位登记先于写者标志的读取，与写者 "置标志 -> 读槽位" 配对
+    aw_fetch_add(&l->readers[slot].value, 1, AW_MO_SEQ_CST);
+    if (aw_load(&l->writer.value, AW_MO_SEQ_CST) == 0) {
+        return slot;
+    }
+    aw_fetch_sub(&l->readers[slot].value, 1, AW_MO_RELEASE);
+    return -1;
+}
+
+AW_INLINE int aw_rwlock_read_lock(aw_rwlock_t* l) {
+    aw_backoff_t bo = AW_BACKOFF_INIT;
+    int slot;
+
+    while ((slot = aw_rwlock_try_read_lock(l)) < 0) {
+        // 让路给写者，等其离开后再重新登记
+        while (aw_load_rlx(&l->writer.value) != 0) {
+            aw_backoff_spin(&bo);
+        }
+    }
+    return slot;
+}
+
+AW_INLINE void aw_rwlock_read_unlock(aw_rwlock_t* l, int slot) {
+    aw_fetch_sub(&l->readers[slot].value, 1, AW_MO_RELEASE);
+}
+
+// ============================================================================
+// 2. 写者
+// ============================================================================
+
+AW_INLINE bool _aw_rwlock_readers_drained(aw_rwlock_t* l) {
+    int i;
+
+    for (i = 0; i < AW_RWLOCK_SLOTS; i++) {
+        if (aw_load(&l->readers[i].value, AW_MO_SEQ_CST) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 尝试写加锁: 当前无写者且无读者时成功
+AW_INLINE bool aw_rwlock_try_write_lock(aw_rwlock_t* l) {
+    int exp = 0;
+
+    if (!aw_cas(&l->writer.value, &exp, 1, AW_MO_SEQ_CST, AW_MO_RELAXED)) {
+        return false;
+    }
+    if (_aw_rwlock_readers_drained(l)) {
+        return true;
+    }
+    aw_store_rel(&l->writer.value, 0);
+    return false;
+}
+
+AW_INLINE void aw_rwlock_write_lock(aw_rwlock_t* l) {
+    aw_backoff_t bo = AW_BACKOFF_INIT;
+    int i;
+
+    // 1. 抢占写者标志，此后新来的读者都会让路
+    for (;;) {
+        int exp = 0;
+        if (aw_load_rlx(&l->writer.value) == 0 &&
+            aw_cas(&l->writer.value, &exp, 1, AW_MO_SEQ_CST, AW_MO_RELAXED)) {
+            break;
+        }
+        aw_backoff_spin(&bo);
+    }
+
+    // 2. 等待已进入的读者全部退出 (Acquire: 与读者解锁的 Release 同步)
+    for (i = 0; i < AW_RWLOCK_SLOTS; i++) {
+        while (aw_load(&l->readers[i].value, AW_MO_SEQ_CST) != 0) {
+            AW_PROFILE_SPIN(1);
+            aw_cpu_pause();
+        }
+    }
+}
+
+AW_INLINE void aw_rwlock_write_unlock(aw_rwlock_t* l) {
+    aw_store_rel(&l->writer.value, 0);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_RWLOCK_H
@@ -0,0 +1,161 @@
+#ifndef AW_SEQLOCK_H
+#define AW_SEQLOCK_H
+
+#include "aw_atomic_simple.h"
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Sequence Lock (顺序锁，读多写少场景)
+ * ============================================================================
+ * 写者在修改数据前把序列号加到奇数，修改完成后再加到偶数；读者记录开始时的
+ * 偶数序列号，拷贝数据后检查序列号未变化，否则重试。
+ * 读者全程只读共享内存 (不做任何 RMW / 写入)，因此任意多个读者之间不会互相竞争。
+ *
+ * 内存序 (写者):
+ *   seq = s + 1   (Relaxed)
+ *   fence(Release)          -- 保证后续数据写入不会先于奇数序列号可见
+ *   ... 数据写入 (Relaxed) ...
+ *   seq = s + 2   (Release) -- 发布数据
+ *
+ * 内存序 (读者):
+ *   s = seq       (Acquire) -- 与上一次写者的结束同步
+ *   ... 数据读取 (Relaxed) ...
+ *   fence(Acquire)          -- 保证数据读取先于序列号的再次读取完成
+ *   seq == s ?    (Relaxed)
+ *
+ * 数据本身必须通过原子方式访问才能避免 C11 意义上的数据竞争，
+ * aw_seqlock_copy_in / aw_seqlock_copy_out 以机器字为单位完成这一工作，
+ * 可用于任意大小的结构体。
+ *
+ * 示例:
+ *   // 写者
+ *   aw_seqlock_write(&sl, &shared_cfg, &new_cfg, sizeof(new_cfg));
+ *   // 读者
+ *   aw_seqlock_read(&sl, &local_cfg, &shared_cfg, sizeof(local_cfg));
+ */
+
+typedef struct {
+    aw_atomic_uint_t seq;       // 奇数: 写入进行中
+} aw_seqlock_t;
+
+#define AW_SEQLOCK_INIT { AW_ATOMIC_VAR_INIT(0) }
+
+AW_INLINE void aw_seqlock_init(aw_seqlock_t* sl) {
+    aw_store_rlx(&sl->seq, 0);
+}
+
+// ============================================================================
+// 1. 写者
+// ============================================================================
+
+// 开始写入。多个写者之间通过 CAS 互斥，写者之间无需额外加锁
+AW_INLINE void aw_seqlock_write_begin(aw_seqlock_t* sl) {
+    unsigned int s;
+
+    for (;;) {
+        s = aw_load_rlx(&sl->seq);
+        if ((s & 1u) == 0 &&
+            aw_cas(&sl->seq, &s, s + 1, AW_MO_ACQUIRE, AW_MO_RELAXED)) {
+            break;
+        }
+        AW_PROFILE_SPIN(1);
+        aw_cpu_pause();
+    }
+    aw_fence_rel();
+}
+
+AW_INLINE void aw_seqlock_write_end(aw_seqlock_t* sl) {
+    unsigned int s = aw_load_rlx(&sl->seq);
+    aw_store_rel(&sl->seq, s + 1);
+}
+
+// ============================================================================
+// 2. 读者
+// ============================================================================
+
+// 开始读取，返回本次读取的序列号 (写入进行中时会等待)
+AW_INLINE unsigned int aw_seqlock_read_begin(aw_seqlock_t* sl) {
+    unsigned int s;
+
+    while (((s = aw_load_acq(&sl->seq)) & 1u) != 0) {
+        AW_PROFILE_SPIN(1);
+        aw_cpu_pause();
+    }
+    return s;
+}
+
+// 读取结束后调用，返回 true 表示期间发生了写入，读到的数据必须丢弃并重试
+AW_INLINE bool aw_seqlock_read_retry(aw_seqlock_t* sl, unsigned int start) {
+    aw_fence_acq();
+    return aw_load_rlx(&sl->seq) != start;
+}
+
+// ============================================================================
+// 3. 任意大小数据的拷贝
+// ============================================================================
+
+typedef aw_atomic_t(unsigned char) _aw_seqlock_byte_t;
+
+// 从共享区拷出 size 字节 (读者侧，只做 Relaxed 读取)
+AW_INLINE void aw_seqlock_copy_out(void* dst, const void* shared, size_t size) {
+    unsigned char* d = (unsigned char*)dst;
+    size_t i = 0;
+
+    // 共享区按机器字对齐时逐字读取，否则逐字节读取
+    if (((uintptr_t)shared % sizeof(size_t)) == 0) {
+        aw_atomic_size_t* sw = (aw_atomic_size_t*)shared;
+        for (; i + sizeof(size_t) <= size; i += sizeof(size_t)) {
+            size_t w = aw_load_rlx(sw++);
+            memcpy(d + i, &w, sizeof(w));
+        }
+    }
+    for (; i < size; i++) {
+        d[i] = aw_load_rlx((_aw_seqlock_byte_t*)shared + i);
+    }
+}
+
+// 向共享区拷入 size 字节 (写者侧，只做 Relaxed 写入)
+AW_INLINE void aw_seqlock_copy_in(void* shared, const void* src, size_t size) {
+    const unsigned char* s = (const unsigned char*)src;
+    size_t i = 0;
+
+    if (((uintptr_t)shared % sizeof(size_t)) == 0) {
+        aw_atomic_size_t* sw = (aw_atomic_size_t*)shared;
+        for (; i + sizeof(size_t) <= size; i += sizeof(size_t)) {
+            size_t w;
+            memcpy(&w, s + i, sizeof(w));
+            aw_store_rlx(sw++, w);
+        }
+    }
+    for (; i < size; i++) {
+        aw_store_rlx((_aw_seqlock_byte_t*)shared + i, s[i]);
+    }
+}
+
+// 读取一份一致的快照到 dst，发生并发写入时自动重试
+AW_INLINE void aw_seqlock_read(aw_seqlock_t* sl, void* dst, const void* shared, size_t size) {
+    unsigned int s;
+
+    do {
+        s = aw_seqlock_read_begin(sl);
+        aw_seqlock_copy_out(dst, shared, size);
+    } while (aw_seqlock_read_retry(sl, s));
+}
+
+// 以一次完整的写事务把 src 发布到共享区
+AW_INLINE void aw_seqlock_write(aw_seqlock_t* sl, void* shared, const void* src, size_t size) {
+    aw_seqlock_write_begin(sl);
+    aw_seqlock_copy_in(shared, src, size);
+    aw_seqlock_write_end(sl);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_SEQLOCK_H
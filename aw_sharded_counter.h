@@ -0,0 +1,89 @@
+#ifndef AW_SHARDED_COUNTER_H
+#define AW_SHARDED_COUNTER_H
+
+#include "aw_thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Sharded Counter (分片计数器)
+ * ============================================================================
+ * 把一个高频递增的全局计数器拆成 AW_SHARDED_COUNTER_CELLS 个各占一条缓存行的
+ * 分片，每个线程固定写入其中一个分片，读取时把所有分片求和。
+ * 写入路径只触及本线程所在分片的缓存行，在多核高并发下不会再被单一缓存行
+ * 的所有权争夺卡住吞吐；代价是读取需要遍历所有分片，适合写多读少的统计计数。
+ *
+ * 分片选择:
+ * - 默认按 aw_thread_hint() (线程首次使用时领取的编号) 选择;
+ * - 定义 AW_SHARDED_COUNTER_USE_CPU 后在支持的平台上按当前 CPU 编号选择。
+ *
+ * 接口沿用 aw_faa_* 系列的命名，替换时只需在名字中加上 sharded:
+ *   aw_inc_rlx(&hits)          ->  aw_sharded_inc_rlx(&hits)
+ *   aw_faa_rlx(&bytes, n)      ->  aw_sharded_faa_rlx(&bytes, n)
+ *   aw_load_rlx(&hits)         ->  aw_sharded_load_rlx(&hits)
+ * 与 aw_faa_rlx 不同，分片版本不返回旧值 (单个分片的旧值没有意义)。
+ */
+
+#ifndef AW_SHARDED_COUNTER_CELLS
+#define AW_SHARDED_COUNTER_CELLS 16
+#endif
+
+typedef aw_padded_atomic_ullong_t aw_sharded_cell_t;
+
+typedef struct {
+    aw_sharded_cell_t cells[AW_SHARDED_COUNTER_CELLS];
+} aw_sharded_counter_t;
+
+AW_INLINE void aw_sharded_counter_init(aw_sharded_counter_t* c) {
+    int i;
+    for (i = 0; i < AW_SHARDED_COUNTER_CELLS; i++) {
+        aw_store_rlx(&c->cells[i].value, 0);
+    }
+}
+
+// 当前线程写入的分片
+AW_INLINE aw_atomic_ullong_t* _aw_sharded_cell(aw_sharded_counter_t* c) {
+#if defined(AW_SHARDED_COUNTER_USE_CPU) && defined(AW_HAS_CPU_ID)
+    int cpu = aw_cpu_id();
+    unsigned int idx = cpu >= 0 ? (unsigned int)cpu : aw_thread_hint();
+#else
+    unsigned int idx = aw_thread_hint();
+#endif
+    return &c->cells[idx % AW_SHARDED_COUNTER_CELLS].value;
+}
+
+// --- 写入 (Relaxed，仅保证最终求和正确) ---
+AW_INLINE void aw_sharded_faa_rlx(aw_sharded_counter_t* c, unsigned long long val) {
+    aw_faa_rlx(_aw_sharded_cell(c), val);
+}
+
+AW_INLINE void aw_sharded_fas_rlx(aw_sharded_counter_t* c, unsigned long long val) {
+    aw_fas_rlx(_aw_sharded_cell(c), val);
+}
+
+#define aw_sharded_inc_rlx(c) aw_sharded_faa_rlx(c, 1)
+#define aw_sharded_dec_rlx(c) aw_sharded_fas_rlx(c, 1)
+
+// --- 读取: 对所有分片求和 (并发写入时结果是某一时刻附近的近似值) ---
+AW_INLINE unsigned long long aw_sharded_load_rlx(aw_sharded_counter_t* c) {
+    unsigned long long sum = 0;
+    int i;
+    for (i = 0; i < AW_SHARDED_COUNTER_CELLS; i++) {
+        sum += aw_load_rlx(&c->cells[i].value);
+    }
+    return sum;
+}
+
+// 清零所有分片，与并发写入之间没有原子性保证
+AW_INLINE void aw_sharded_reset(aw_sharded_counter_t* c) {
+    aw_sharded_counter_init(c);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_SHARDED_COUNTER_H
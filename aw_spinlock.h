@@ -0,0 +1,80 @@
+#ifndef AW_SPINLOCK_H
+#define AW_SPINLOCK_H
+
+#include "aw_atomic_simple.h"
+#include "aw_backoff.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Spinlock (Test-and-Test-and-Set + 指数退避)
+ * ============================================================================
+ * - 加锁: 先用一次 Acquire 交换尝试抢锁；失败后只用 Relaxed 读取在本地缓存
+ *   中观察锁状态 (不产生总线写)，直到观察到锁空闲再重新交换。只有这次交换
+ *   仍然失败 (与其他等待者撞车) 时才按指数退避等待，退避不随持有时间增长。
+ * - 解锁: 一次 Release 写入。
+ *
+ * 与直接循环 aw_swap_ar 相比，等待者在锁被持有期间不会反复使缓存行失效，
+ * 因此在 16+ 线程竞争时锁的交接开销不会随线程数线性恶化。
+ *
+ * 示例:
+ *   static aw_spinlock_t lock = AW_SPINLOCK_INIT;
+ *   aw_spinlock_lock(&lock);
+ *   // ... 临界区 ...
+ *   aw_spinlock_unlock(&lock);
+ */
+
+typedef struct {
+    aw_atomic_int_t locked;     // 0: 空闲, 1: 已持有
+} aw_spinlock_t;
+
+#define AW_SPINLOCK_INIT { AW_ATOMIC_VAR_INIT(0) }
+
+AW_INLINE void aw_spinlock_init(aw_spinlock_t* lock) {
+    aw_store_rlx(&lock->locked, 0);
+}
+
+// 尝试加锁，成功返回 true。锁已被持有时不发起任何写操作
+AW_INLINE bool aw_spinlock_try_lock(aw_spinlock_t* lock) {
+    return aw_load_rlx(&lock->locked) == 0 &&
+           aw_exchange(&lock->locked, 1, AW_MO_ACQUIRE) == 0;
+}
+
+AW_INLINE void aw_spinlock_lock(aw_spinlock_t* lock) {
+    aw_backoff_t bo = AW_BACKOFF_INIT;
+
+    for (;;) {
+        if (aw_exchange(&lock->locked, 1, AW_MO_ACQUIRE) == 0) {
+            return;
+        }
+        // 只读自旋: 缓存行保持 Shared 状态，直到持有者解锁。这里只做单次 pause，
+        // 否则持有时间一长退避就涨到上限，锁释放后要多等一整段退避才能发现
+        while (aw_load_rlx(&lock->locked) != 0) {
+            AW_PROFILE_SPIN(1);
+            aw_cpu_pause();
+        }
+        // 观察到空闲后的交换若失败，说明有其他等待者同时抢锁，此时才增长退避
+        if (aw_exchange(&lock->locked, 1, AW_MO_ACQUIRE) == 0) {
+            return;
+        }
+        aw_backoff_spin(&bo);
+    }
+}
+
+AW_INLINE void aw_spinlock_unlock(aw_spinlock_t* lock) {
+    aw_store_rel(&lock->locked, 0);
+}
+
+// 仅用于调试/断言，结果在返回时可能已经过期
+AW_INLINE bool aw_spinlock_is_locked(aw_spinlock_t* lock) {
+    return aw_load_rlx(&lock->locked) != 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_SPINLOCK_H
@@ -0,0 +1,165 @@
+#ifndef AW_SPSC_RING_H
+#define AW_SPSC_RING_H
+
+#include "aw_atomic_simple.h"
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW SPSC Ring Buffer (单生产者/单消费者无等待环形队列)
+ * ============================================================================
+ * - 容量必须为 2 的幂，下标自由递增，通过掩码取模。
+ * - 生产者写 tail、消费者写 head，两者分别位于独立的缓存行。
+ * - 生产者本地缓存一份 head (消费者缓存一份 tail)，只有当缓存值显示
+ *   队列已满 (已空) 时才去读取对方的下标，常规路径不会触及对方的缓存行。
+ * - 批量接口 push_n / pop_n 拷贝 N 个元素后只做一次 Release 写入。
+ *
+ * 元素按值拷贝存储，元素大小在初始化时给定；存储区由调用方提供，
+ * 大小为 capacity * elem_size 字节。
+ *
+ * 示例:
+ *   static msg_t storage[1024];
+ *   aw_spsc_ring_t ring;
+ *   aw_spsc_ring_init(&ring, storage, 1024, sizeof(msg_t));
+ *   // 生产者线程
+ *   aw_spsc_ring_push(&ring, &msg);
+ *   // 消费者线程
+ *   if (aw_spsc_ring_pop(&ring, &msg)) { ... }
+ */
+
+typedef struct AW_CACHELINE_ALIGN {
+    // --- 只读区: 初始化后不再修改 ---
+    unsigned char* buf;
+    size_t         mask;
+    size_t         elem_size;
+    char           _pad0[AW_CACHELINE_SIZE - sizeof(unsigned char*) - 2 * sizeof(size_t)];
+
+    // --- 生产者独占缓存行 ---
+    aw_atomic_size_t tail;          // 下一个写入位置 (仅生产者写)
+    size_t           head_cache;    // 生产者看到的 head 副本
+    char             _pad1[AW_CACHELINE_SIZE - sizeof(aw_atomic_size_t) - sizeof(size_t)];
+
+    // --- 消费者独占缓存行 ---
+    aw_atomic_size_t head;          // 下一个读取位置 (仅消费者写)
+    size_t           tail_cache;    // 消费者看到的 tail 副本
+    char             _pad2[AW_CACHELINE_SIZE - sizeof(aw_atomic_size_t) - sizeof(size_t)];
+} aw_spsc_ring_t;
+
+// 初始化，capacity 不是 2 的幂或参数非法时返回 false
+AW_INLINE bool aw_spsc_ring_init(aw_spsc_ring_t* r, void* buf, size_t capacity, size_t elem_size) {
+    if (buf == NULL || elem_size == 0 || capacity == 0 || (capacity & (capacity - 1)) != 0) {
+        return false;
+    }
+    r->buf        = (unsigned char*)buf;
+    r->mask       = capacity - 1;
+    r->elem_size  = elem_size;
+    r->head_cache = 0;
+    r->tail_cache = 0;
+    aw_store_rlx(&r->tail, 0);
+    aw_store_rlx(&r->head, 0);
+    return true;
+}
+
+AW_INLINE size_t aw_spsc_ring_capacity(const aw_spsc_ring_t* r) {
+    return r->mask + 1;
+}
+
+// 当前元素个数的近似值 (两端并发修改时仅供参考)
+AW_INLINE size_t aw_spsc_ring_size_approx(aw_spsc_ring_t* r) {
+    size_t head = aw_load_rlx(&r->head);
+    size_t tail = aw_load_rlx(&r->tail);
+    return tail - head;
+}
+
+// ============================================================================
+// 1. 生产者接口
+// ============================================================================
+
+// 写入最多 n 个元素，返回实际写入的个数 (队列满时可能小于 n)
+AW_INLINE size_t aw_spsc_ring_push_n(aw_spsc_ring_t* r, const void* elems, size_t n) {
+    size_t cap  = r->mask + 1;
+    size_t tail = aw_load_rlx(&r->tail);
+    size_t room = cap - (tail - r->head_cache);
+    size_t idx, first;
+
+    if (room < n) {
+        // 缓存值显示空间不足时才读取消费者的 head
+        r->head_cache = aw_load_acq(&r->head);
+        room = cap - (tail - r->head_cache);
+        if (room < n) {
+            n = room;
+        }
+    }
+    if (n == 0) {
+        return 0;
+    }
+
+    // 环绕时分两段拷贝
+    idx   = tail & r->mask;
+    first = cap - idx;
+    if (first > n) {
+        first = n;
+    }
+    memcpy(r->buf + idx * r->elem_size, elems, first * r->elem_size);
+    if (n > first) {
+        memcpy(r->buf, (const unsigned char*)elems + first * r->elem_size, (n - first) * r->elem_size);
+    }
+
+    aw_store_rel(&r->tail, tail + n);
+    return n;
+}
+
+AW_INLINE bool aw_spsc_ring_push(aw_spsc_ring_t* r, const void* elem) {
+    return aw_spsc_ring_push_n(r, elem, 1) == 1;
+}
+
+// ============================================================================
+// 2. 消费者接口
+// ============================================================================
+
+// 读出最多 n 个元素，返回实际读出的个数 (队列空时可能小于 n)
+AW_INLINE size_t aw_spsc_ring_pop_n(aw_spsc_ring_t* r, void* out, size_t n) {
+    size_t cap   = r->mask + 1;
+    size_t head  = aw_load_rlx(&r->head);
+    size_t avail = r->tail_cache - head;
+    size_t idx, first;
+
+    if (avail < n) {
+        // 缓存值显示数据不足时才读取生产者的 tail
+        r->tail_cache = aw_load_acq(&r->tail);
+        avail = r->tail_cache - head;
+        if (avail < n) {
+            n = avail;
+        }
+    }
+    if (n == 0) {
+        return 0;
+    }
+
+    idx   = head & r->mask;
+    first = cap - idx;
+    if (first > n) {
+        first = n;
+    }
+    memcpy(out, r->buf + idx * r->elem_size, first * r->elem_size);
+    if (n > first) {
+        memcpy((unsigned char*)out + first * r->elem_size, r->buf, (n - first) * r->elem_size);
+    }
+
+    aw_store_rel(&r->head, head + n);
+    return n;
+}
+
+AW_INLINE bool aw_spsc_ring_pop(aw_spsc_ring_t* r, void* out) {
+    return aw_spsc_ring_pop_n(r, out, 1) == 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_SPSC_RING_H
@@ -0,0 +1,263 @@
+#ifndef AW_TASK_POOL_H
+#define AW_TASK_POOL_H
+
+#include "aw_ws_deque.h"
+#include "aw_lf_stack.h"
+#include "aw_eventcount.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Task Pool (基于工作窃取的 fork/join 任务池)
+ * ============================================================================
+ * 每个工作者持有一个 aw_ws_deque_t。任务在执行过程中用 aw_task_spawn 把子任务
+ * 压入本工作者的队列底部；工作者先从自己的队列底部取任务 (LIFO，局部性好)，
+ * 为空时从随机选择的其他工作者顶部窃取，仍然没有任务时挂起 (aw_wait)。
+ *
+ * - 工作者线程由调用方创建，在线程函数中调用 aw_task_worker_run(w)，
+ *   直到 aw_task_pool_stop 后返回。
+ * - 非工作者线程通过 aw_task_submit 投递任务: 任务压入共享的注入栈，
+ *   由空闲的工作者整批取走 (aw_lf_stack_pop_all，不解引用任务节点)。
+ * - fork/join: 父任务以计数器记录未完成的子任务，aw_task_join 在计数归零前
+ *   持续执行其他任务而不是阻塞。
+ *
+ * 挂起通过 aw_eventcount_t: 空闲工作者 prepare_wait 后再检查一遍所有队列，
+ * 仍无任务才 commit_wait；aw_task_submit 压入任务后 aw_eventcount_notify，没有
+ * 挂起的工作者时只有一次屏障和一次读取。aw_task_spawn 只做一次 relaxed 读取
+ * (aw_eventcount_notify_if_waiting)：派生的任务留在本工作者队列中，本工作者
+ * 在 join 或取任务时总会执行它，漏掉一次唤醒只损失并行度，不会丢任务。
+ *
+ * 示例:
+ *   typedef struct { aw_task_t task; int n; aw_atomic_long_t* pending; } job_t;
+ *   static void job_run(aw_task_t* t, aw_task_worker_t* w) {
+ *       job_t* j = AW_CONTAINER_OF(t, job_t, task);
+ *       ...
+ *       aw_dec_ar(j->pending);
+ *   }
+ */
+
+struct aw_task_worker;
+
+typedef struct aw_task {
+    void (*run)(struct aw_task* task, struct aw_task_worker* w);
+    aw_lf_node_t inject;                // aw_task_submit 使用的注入栈节点
+} aw_task_t;
+
+struct aw_task_pool;
+
+typedef struct AW_CACHELINE_ALIGN aw_task_worker {
+    aw_ws_deque_t        deque;
+    struct aw_task_pool* pool;
+    unsigned int         index;
+    unsigned int         rng;           // 选择窃取对象的 xorshift 状态
+} aw_task_worker_t;
+
+typedef struct aw_task_pool {
+    aw_task_worker_t*       workers;
+    unsigned int            nworkers;
+    aw_lf_stack_t           inject;     // 外部投递的任务
+    aw_eventcount_t         idle;       // 空闲工作者在此挂起
+    aw_atomic_int_t         stop;
+} aw_task_pool_t;
+
+// 工作者数组由调用方提供，每个工作者的队列初始容量为 2^log_capacity
+AW_INLINE bool aw_task_pool_init(aw_task_pool_t* pool, aw_task_worker_t* workers,
+                                 unsigned int nworkers, unsigned int log_capacity) {
+    unsigned int i;
+
+    pool->workers  = workers;
+    pool->nworkers = nworkers;
+    aw_lf_stack_init(&pool->inject);
+    aw_eventcount_init(&pool->idle);
+    aw_store_rlx(&pool->stop, 0);
+    for (i = 0; i < nworkers; i++) {
+        if (!aw_ws_deque_init(&workers[i].deque, log_capacity)) {
+            while (i-- > 0) {
+                aw_ws_deque_destroy(&workers[i].deque);
+            }
+            return false;
+        }
+        workers[i].pool  = pool;
+        workers[i].index = i;
+        workers[i].rng   = 0x9E3779B9u * (i + 1);
+    }
+    aw_fence_rel();
+    return true;
+}
+
+// 所有工作者退出 aw_task_worker_run 后调用
+AW_INLINE void aw_task_pool_destroy(aw_task_pool_t* pool) {
+    unsigned int i;
+
+    for (i = 0; i < pool->nworkers; i++) {
+        aw_ws_deque_destroy(&pool->workers[i].deque);
+    }
+}
+
+// ============================================================================
+// 1. 唤醒
+// ============================================================================
+
+// 通知所有工作者退出
+AW_INLINE void aw_task_pool_stop(aw_task_pool_t* pool) {
+    aw_store_rel(&pool->stop, 1);
+    aw_eventcount_notify_all(&pool->idle);
+}
+
+// ============================================================================
+// 2. 投递
+// ============================================================================
+
+// 在工作者上下文中派生任务 (压入本工作者队列)；队列扩容失败时就地执行
+AW_INLINE void aw_task_spawn(aw_task_worker_t* w, aw_task_t* task) {
+    if (!aw_ws_deque_push(&w->deque, task)) {
+        task->run(task, w);
+        return;
+    }
+    // 热路径: 没有挂起的工作者时不做屏障 (见文件开头)
+    aw_eventcount_notify_if_waiting(&w->pool->idle);
+}
+
+// 从非工作者线程投递任务
+AW_INLINE void aw_task_submit(aw_task_pool_t* pool, aw_task_t* task) {
+    aw_lf_stack_push(&pool->inject, &task->inject);
+    aw_eventcount_notify(&pool->idle);
+}
+
+// ============================================================================
+// 3. 取任务
+// ============================================================================
+
+AW_INLINE unsigned int _aw_task_rand(aw_task_worker_t* w) {
+    unsigned int x = w->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    w->rng = x;
+    return x;
+}
+
+// 把注入栈整批转入本工作者队列，返回其中一个任务
+AW_INLINE aw_task_t* _aw_task_take_injected(aw_task_worker_t* w) {
+    aw_lf_node_t* node = aw_lf_stack_pop_all(&w->pool->inject);
+    aw_task_t* first = NULL;
+
+    while (node != NULL) {
+        aw_lf_node_t* next = (aw_lf_node_t*)aw_load_rlx(&node->next);
+        aw_task_t* task = AW_CONTAINER_OF(node, aw_task_t, inject);
+
+        if (first == NULL) {
+            first = task;
+        } else if (!aw_ws_deque_push(&w->deque, task)) {
+            task->run(task, w);
+        }
+        node = next;
+    }
+    return first;
+}
+
+// 依次尝试: 本地队列 -> 注入栈 -> 从随机起点轮询窃取
+AW_INLINE aw_task_t* _aw_task_find(aw_task_worker_t* w) {
+    aw_task_pool_t* pool = w->pool;
+    aw_task_t* task = (aw_task_t*)aw_ws_deque_take(&w->deque);
+    unsigned int i, start;
+
+    if (task != NULL) {
+        return task;
+    }
+    if (!aw_lf_stack_empty(&pool->inject)) {
+        task = _aw_task_take_injected(w);
+        if (task != NULL) {
+            return task;
+        }
+    }
+    start = _aw_task_rand(w) % pool->nworkers;
+    for (i = 0; i < pool->nworkers; i++) {
+        aw_task_worker_t* victim = &pool->workers[(start + i) % pool->nworkers];
+        if (victim != w) {
+            task = (aw_task_t*)aw_ws_deque_steal(&victim->deque);
+            if (task != NULL) {
+                return task;
+            }
+        }
+    }
+    return NULL;
+}
+
+AW_INLINE bool _aw_task_pool_has_work(aw_task_pool_t* pool) {
+    unsigned int i;
+
+    if (!aw_lf_stack_empty(&pool->inject)) {
+        return true;
+    }
+    for (i = 0; i < pool->nworkers; i++) {
+        if (aw_ws_deque_size(&pool->workers[i].deque) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 执行一个任务，没有可执行的任务时返回 false
+AW_INLINE bool aw_task_run_one(aw_task_worker_t* w) {
+    aw_task_t* task = _aw_task_find(w);
+
+    if (task == NULL) {
+        return false;
+    }
+    task->run(task, w);
+    return true;
+}
+
+// 在 *pending 归零之前持续执行其他任务 (fork/join 的 join)
+AW_INLINE void aw_task_join(aw_task_worker_t* w, aw_atomic_long_t* pending) {
+    while (aw_load_acq(pending) != 0) {
+        if (!aw_task_run_one(w)) {
+            AW_PROFILE_SPIN(1);
+            aw_cpu_pause();
+        }
+    }
+}
+
+// ============================================================================
+// 4. 工作者主循环
+// ============================================================================
+
+#ifndef AW_TASK_IDLE_ROUNDS
+#define AW_TASK_IDLE_ROUNDS 64          // 挂起前空转的轮数
+#endif
+
+AW_INLINE void aw_task_worker_run(aw_task_worker_t* w) {
+    aw_task_pool_t* pool = w->pool;
+    unsigned int idle = 0;
+
+    while (aw_load_acq(&pool->stop) == 0) {
+        unsigned int key;
+
+        if (aw_task_run_one(w)) {
+            idle = 0;
+            continue;
+        }
+        if (++idle < AW_TASK_IDLE_ROUNDS) {
+            aw_cpu_pause();
+            continue;
+        }
+
+        key = aw_eventcount_prepare_wait(&pool->idle);
+        if (_aw_task_pool_has_work(pool) || aw_load_acq(&pool->stop) != 0) {
+            aw_eventcount_cancel_wait(&pool->idle);
+        } else {
+            aw_eventcount_commit_wait(&pool->idle, key);
+        }
+        idle = 0;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_TASK_POOL_H
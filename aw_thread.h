@@ -0,0 +1,47 @@
+#ifndef AW_THREAD_H
+#define AW_THREAD_H
+
+#include "aw_atomic_simple.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Thread Helpers (线程分散辅助)
+ * ============================================================================
+ * 为分片计数器、分布式读者槽位等结构提供 "每个线程尽量落到不同分片" 的提示值。
+ * 提示值只用于分散竞争，不保证唯一，使用者不能依赖它做互斥。
+ */
+
+// 当前线程的提示编号: 首次调用时从计数器领取，此后固定不变。
+// 编号在每个编译单元内独立分配 (头文件内的静态变量)，不同编译单元可能重复。
+AW_INLINE unsigned int aw_thread_hint(void) {
+    static AW_THREAD_LOCAL unsigned int hint;   // 0 表示尚未分配
+    static aw_atomic_uint_t next_hint;
+
+    if (hint == 0) {
+        hint = aw_fetch_add(&next_hint, 1, AW_MO_RELAXED) + 1;
+    }
+    return hint - 1;
+}
+
+// 当前线程所在的 CPU 编号，平台不支持时返回 -1
+#if defined(__linux__)
+    extern int sched_getcpu(void);
+    #define AW_HAS_CPU_ID
+    AW_INLINE int aw_cpu_id(void) {
+        return sched_getcpu();
+    }
+#else
+    AW_INLINE int aw_cpu_id(void) {
+        return -1;
+    }
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_THREAD_H
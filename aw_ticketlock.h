@@ -0,0 +1,73 @@
+#ifndef AW_TICKETLOCK_H
+#define AW_TICKETLOCK_H
+
+#include "aw_atomic_simple.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Ticket Lock (公平 FIFO 自旋锁)
+ * ============================================================================
+ * - 加锁: aw_fetch_add 取号 (每个等待者只做一次 RMW)，随后以 Acquire 读取
+ *   等待 owner 叫到自己的号。
+ * - 解锁: owner + 1 的 Release 写入，只有锁的持有者会写 owner，因此无需 RMW。
+ *
+ * 严格按取号顺序获得锁，不会出现饥饿；等待者根据与 owner 的号码距离
+ * 按比例退避，离得越远读取越少。
+ */
+
+// 每个排在前面的等待者对应的 pause 次数 (比例退避系数)
+#ifndef AW_TICKETLOCK_BACKOFF_UNIT
+#define AW_TICKETLOCK_BACKOFF_UNIT 32u
+#endif
+
+typedef struct {
+    aw_atomic_uint_t next;      // 下一个要发放的号码
+    aw_atomic_uint_t owner;     // 当前被叫到的号码
+} aw_ticketlock_t;
+
+#define AW_TICKETLOCK_INIT { AW_ATOMIC_VAR_INIT(0), AW_ATOMIC_VAR_INIT(0) }
+
+AW_INLINE void aw_ticketlock_init(aw_ticketlock_t* lock) {
+    aw_store_rlx(&lock->next, 0);
+    aw_store_rlx(&lock->owner, 0);
+}
+
+AW_INLINE void aw_ticketlock_lock(aw_ticketlock_t* lock) {
+    unsigned int ticket = aw_fetch_add(&lock->next, 1, AW_MO_RELAXED);
+    unsigned int cur;
+
+    while ((cur = aw_load_acq(&lock->owner)) != ticket) {
+        unsigned int n = (ticket - cur) * AW_TICKETLOCK_BACKOFF_UNIT;
+        AW_PROFILE_SPIN(n);
+        while (n--) {
+            aw_cpu_pause();
+        }
+    }
+}
+
+// 仅在当前无人持有且无人排队时取号成功
+AW_INLINE bool aw_ticketlock_try_lock(aw_ticketlock_t* lock) {
+    unsigned int cur = aw_load_rlx(&lock->owner);
+    unsigned int exp = cur;
+    return aw_cas(&lock->next, &exp, cur + 1, AW_MO_ACQUIRE, AW_MO_RELAXED);
+}
+
+AW_INLINE void aw_ticketlock_unlock(aw_ticketlock_t* lock) {
+    unsigned int cur = aw_load_rlx(&lock->owner);
+    aw_store_rel(&lock->owner, cur + 1);
+}
+
+// 仅用于调试/断言，结果在返回时可能已经过期
+AW_INLINE bool aw_ticketlock_is_locked(aw_ticketlock_t* lock) {
+    return aw_load_rlx(&lock->next) != aw_load_rlx(&lock->owner);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_TICKETLOCK_H
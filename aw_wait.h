@@ -0,0 +1,216 @@
+#ifndef AW_WAIT_H
+#define AW_WAIT_H
+
+#include "aw_atomic_simple.h"
+#include <string.h>
+
+#if defined(__linux__)
+    #include <unistd.h>
+    #include <sys/syscall.h>
+    #include <linux/futex.h>
+    // 严格 C 标准模式 (-std=c11) 下 unistd.h 不声明 syscall()，C 中补充声明；
+    // C++ 下 g++ 默认定义 _GNU_SOURCE，直接使用 unistd.h 中的 extern "C" 声明
+    #ifndef __cplusplus
+    extern long syscall(long number, ...);
+    #endif
+    #define AW_WAIT_FUTEX
+#elif defined(AW_COMPILER_MSVC)
+    // WaitOnAddress 系列 (Windows 8+)
+    #pragma comment(lib, "Synchronization.lib")
+    #define AW_WAIT_WIN32
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Wait / Notify (在原子变量上阻塞等待，相当于 C++20 atomic::wait)
+ * ============================================================================
+ * - aw_wait(ptr, old, order): 只要 *ptr 仍等于 old 就阻塞；返回时 *ptr 已不等于
+ *   old (以 order 读取)。先自旋 AW_WAIT_SPIN_COUNT 次，再进入内核挂起。
+ * - aw_wait_park(ptr, old, order): 同 aw_wait，但不自旋，直接挂起。调用方已有
+ *   自己的自旋阶段时使用 (如 aw_mutex_t)，避免挂起前再多自旋一轮。
+ * - aw_notify_one(ptr) / aw_notify_all(ptr): 修改 *ptr 之后调用，唤醒等待者。
+ *
+ * 实现:
+ * - Linux: 32 位变量直接在变量本身上 futex(FUTEX_WAIT_PRIVATE / FUTEX_WAKE_PRIVATE)；
+ *   其他宽度 (8/16/64 位) 在按地址散列的停车表桶内的序列号上 futex 等待，
+ *   通知时递增序列号并唤醒整个桶。
+ * - Windows: WaitOnAddress / WakeByAddress*。
+ * - 其他平台 (如无操作系统的嵌入式环境): 退化为 aw_cpu_pause() 自旋。
+ *
+ * 每个停车桶记录当前挂起的等待者数量，没有等待者时 notify 只有一次屏障和
+ * 一次 Relaxed 读取，不会进入内核。
+ *
+ * 示例:
+ *   // 等待方
+ *   int v;
+ *   while ((v = aw_load_acq(&flag)) == 0) aw_wait(&flag, 0, AW_MO_ACQUIRE);
+ *   // 通知方
+ *   aw_store_rel(&flag, 1);
+ *   aw_notify_all(&flag);
+ */
+
+// 进入内核挂起前的自旋次数
+#ifndef AW_WAIT_SPIN_COUNT
+#define AW_WAIT_SPIN_COUNT 64
+#endif
+
+// 停车表桶数 (必须为 2 的幂)
+#ifndef AW_WAIT_TABLE_SIZE
+#define AW_WAIT_TABLE_SIZE 256
+#endif
+
+typedef aw_atomic_t(unsigned char)  _aw_wait_u8_t;
+typedef aw_atomic_t(unsigned short) _aw_wait_u16_t;
+
+// ============================================================================
+// 1. 停车表
+// ============================================================================
+
+typedef struct AW_CACHELINE_ALIGN {
+    aw_atomic_uint_t waiters;   // 正在挂起 (或即将挂起) 的等待者数量
+    aw_atomic_uint_t seq;       // 非 32 位变量的等待序列号
+} _aw_park_bucket_t;
+
+// 停车表必须在所有编译单元之间共享，使用弱符号 / selectany 由链接器合并为一份
+#if defined(AW_COMPILER_MSVC)
+    __declspec(selectany) _aw_park_bucket_t _aw_park_table[AW_WAIT_TABLE_SIZE];
+#else
+    __port_weak _aw_park_bucket_t _aw_park_table[AW_WAIT_TABLE_SIZE];
+#endif
+
+AW_INLINE _aw_park_bucket_t* _aw_park_bucket(const void* addr) {
+    uintptr_t h = (uintptr_t)addr >> 2;
+    h ^= h >> 9;
+    h *= (uintptr_t)0x9E3779B1u;
+    return &_aw_park_table[(h >> 8) & (AW_WAIT_TABLE_SIZE - 1)];
+}
+
+#if defined(AW_WAIT_FUTEX)
+AW_INLINE void _aw_futex_wait(void* addr, unsigned int val) {
+    syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, NULL, NULL, 0);
+}
+
+AW_INLINE void _aw_futex_wake(void* addr, int count) {
+    syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+#endif
+
+// ============================================================================
+// 2. 按宽度读取与比较
+// ============================================================================
+
+AW_INLINE unsigned long long _aw_wait_load(void* addr, size_t size, aw_memory_order order) {
+    switch (size) {
+        case 1:  return aw_load((_aw_wait_u8_t*)addr, order);
+        case 2:  return aw_load((_aw_wait_u16_t*)addr, order);
+        case 4:  return aw_load((aw_atomic_uint_t*)addr, order);
+        default: return aw_load((aw_atomic_ullong_t*)addr, order);
+    }
+}
+
+// 只比较低 size 字节，避免有符号类型的 old 在转换为 64 位时符号扩展造成误判
+AW_INLINE bool _aw_wait_changed(void* addr, size_t size, unsigned long long old, aw_memory_order order) {
+    unsigned long long mask = size >= 8 ? ~0ULL : ((1ULL << (size * 8)) - 1);
+    return ((_aw_wait_load(addr, size, order) ^ old) & mask) != 0;
+}
+
+// ============================================================================
+// 3. 等待与唤醒
+// ============================================================================
+
+// 不自旋，直接挂起 (调用方已自行自旋过时使用)
+AW_INLINE void _aw_wait_park_impl(void* addr, size_t size, unsigned long long old, aw_memory_order order) {
+    for (;;) {
+#if defined(AW_WAIT_FUTEX)
+        _aw_park_bucket_t* b = _aw_park_bucket(addr);
+
+        // SeqCst: 登记等待者先于对变量的检查，与 notify 中的屏障配对
+        aw_fetch_add(&b->waiters, 1, AW_MO_SEQ_CST);
+        if (size == 4) {
+            // 内核会原子地比较 *addr 与 old，已变化时立即返回
+            _aw_futex_wait(addr, (unsigned int)old);
+        } else {
+            unsigned int seq = aw_load(&b->seq, AW_MO_SEQ_CST);
+            if (!_aw_wait_changed(addr, size, old, order)) {
+                _aw_futex_wait((void*)&b->seq, seq);
+            }
+        }
+        aw_fetch_sub(&b->waiters, 1, AW_MO_RELEASE);
+#elif defined(AW_WAIT_WIN32)
+        unsigned long long cmp = old;
+        WaitOnAddress((volatile VOID*)addr, &cmp, size, INFINITE);
+#else
+        aw_cpu_pause();
+#endif
+        // 可能是伪唤醒或散列冲突导致的唤醒，重新检查
+        if (_aw_wait_changed(addr, size, old, order)) {
+            return;
+        }
+    }
+}
+
+AW_INLINE void _aw_wait_impl(void* addr, size_t size, unsigned long long old, aw_memory_order order) {
+    int i;
+
+    for (i = 0; i < AW_WAIT_SPIN_COUNT; i++) {
+        if (_aw_wait_changed(addr, size, old, order)) {
+            return;
+        }
+        AW_PROFILE_SPIN(1);
+        aw_cpu_pause();
+    }
+    _aw_wait_park_impl(addr, size, old, order);
+}
+
+AW_INLINE void _aw_notify_impl(void* addr, size_t size, bool all) {
+#if defined(AW_WAIT_FUTEX)
+    _aw_park_bucket_t* b = _aw_park_bucket(addr);
+
+    // 保证调用方对变量的修改先于等待者计数的读取 (Store-Load 顺序)
+    aw_fence_seq();
+    if (aw_load_rlx(&b->waiters) == 0) {
+        return;
+    }
+    if (size == 4) {
+        _aw_futex_wake(addr, all ? 0x7FFFFFFF : 1);
+    } else {
+        // 桶内可能有等待其他地址的线程，只能全部唤醒
+        aw_fetch_add(&b->seq, 1, AW_MO_SEQ_CST);
+        _aw_futex_wake((void*)&b->seq, 0x7FFFFFFF);
+    }
+#elif defined(AW_WAIT_WIN32)
+    (void)size;
+    if (all) {
+        WakeByAddressAll(addr);
+    } else {
+        WakeByAddressSingle(addr);
+    }
+#else
+    (void)addr;
+    (void)size;
+    (void)all;
+#endif
+}
+
+// ptr 指向 1/2/4/8 字节的原子整型
+#define aw_wait(ptr, old, order) \
+    _aw_wait_impl((void*)(ptr), sizeof(*(ptr)), (unsigned long long)(old), order)
+
+#define aw_wait_park(ptr, old, order) \
+    _aw_wait_park_impl((void*)(ptr), sizeof(*(ptr)), (unsigned long long)(old), order)
+
+#define aw_notify_one(ptr) \
+    _aw_notify_impl((void*)(ptr), sizeof(*(ptr)), false)
+
+#define aw_notify_all(ptr) \
+    _aw_notify_impl((void*)(ptr), sizeof(*(ptr)), true)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_WAIT_H
@@ -0,0 +1,170 @@
+#ifndef AW_WS_DEQUE_H
+#define AW_WS_DEQUE_H
+
+#include "aw_atomic_simple.h"
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * ============================================================================
+ * AW Work-Stealing Deque (Chase-Lev 工作窃取双端队列)
+ * ============================================================================
+ * 按 Lê, Pop, Cohen, Zappa Nardelli, "Correct and Efficient Work-Stealing for
+ * Weak Memory Models" (PPoPP 2013) 中的 C11 形式实现:
+ *
+ * - 所有者线程在底部 push / take，只用 Relaxed 读写加一次 Release 屏障
+ *   (push) 或一次 SeqCst 屏障 (take)，只有取最后一个元素时才与窃取者 CAS;
+ * - 窃取者在顶部 steal，以 SeqCst CAS 推进 top。
+ *
+ * 元素为非 NULL 的 void*。环形数组写满时由所有者扩容为两倍，旧数组可能仍被
+ * 窃取者读取，因此挂在新数组上，直到 aw_ws_deque_destroy 时统一释放。
+ *
+ * 示例:
+ *   aw_ws_deque_t q;
+ *   aw_ws_deque_init(&q, 8);            // 初始容量 2^8
+ *   aw_ws_deque_push(&q, task);         // 仅所有者
+ *   task = aw_ws_deque_take(&q);        // 仅所有者
+ *   task = aw_ws_deque_steal(&q);       // 任意线程
+ */
+
+typedef struct _aw_ws_array {
+    struct _aw_ws_array* prev;          // 被替换下来的旧数组
+    long long            mask;
+    aw_atomic_ptr_t      buf[1];        // 实际长度为 mask + 1
+} _aw_ws_array_t;
+
+typedef struct {
+    aw_padded_atomic_llong_t top;       // 窃取者 CAS 推进
+    aw_padded_atomic_llong_t bottom;    // 仅所有者写入
+    aw_padded_atomic_ptr_t   array;     // _aw_ws_array_t*
+} aw_ws_deque_t;
+
+AW_INLINE _aw_ws_array_t* _aw_ws_array_new(long long size) {
+    _aw_ws_array_t* a = (_aw_ws_array_t*)malloc(
+        sizeof(_aw_ws_array_t) + (size_t)(size - 1) * sizeof(aw_atomic_ptr_t));
+
+    if (a != NULL) {
+        a->prev = NULL;
+        a->mask = size - 1;
+    }
+    return a;
+}
+
+// 初始容量为 2^log_capacity，内存不足时返回 false
+AW_INLINE bool aw_ws_deque_init(aw_ws_deque_t* q, unsigned int log_capacity) {
+    _aw_ws_array_t* a = _aw_ws_array_new(1LL << log_capacity);
+
+    if (a == NULL) {
+        return false;
+    }
+    aw_store_rlx(&q->top.value, 0LL);
+    aw_store_rlx(&q->bottom.value, 0LL);
+    aw_store_rel(&q->array.value, (void*)a);
+    return true;
+}
+
+// 释放当前数组及所有旧数组，调用时不能再有并发访问
+AW_INLINE void aw_ws_deque_destroy(aw_ws_deque_t* q) {
+    _aw_ws_array_t* a = (_aw_ws_array_t*)aw_load_acq(&q->array.value);
+
+    while (a != NULL) {
+        _aw_ws_array_t* prev = a->prev;
+        free(a);
+        a = prev;
+    }
+    aw_store_rlx(&q->array.value, NULL);
+}
+
+// 扩容为两倍并复制 [t, b) 范围内的元素 (仅所有者)
+AW_INLINE _aw_ws_array_t* _aw_ws_grow(aw_ws_deque_t* q, _aw_ws_array_t* a, long long t, long long b) {
+    _aw_ws_array_t* na = _aw_ws_array_new((a->mask + 1) * 2);
+    long long i;
+
+    if (na == NULL) {
+        return NULL;
+    }
+    for (i = t; i < b; i++) {
+        aw_store_rlx(&na->buf[i & na->mask], (void*)aw_load_rlx(&a->buf[i & a->mask]));
+    }
+    na->prev = a;
+    aw_store_rel(&q->array.value, (void*)na);
+    return na;
+}
+
+// 在底部压入 (仅所有者)，扩容失败时返回 false
+AW_INLINE bool aw_ws_deque_push(aw_ws_deque_t* q, void* x) {
+    long long b = aw_load_rlx(&q->bottom.value);
+    long long t = aw_load_acq(&q->top.value);
+    _aw_ws_array_t* a = (_aw_ws_array_t*)aw_load_rlx(&q->array.value);
+
+    if (b - t > a->mask) {
+        a = _aw_ws_grow(q, a, t, b);
+        if (a == NULL) {
+            return false;
+        }
+    }
+    aw_store_rlx(&a->buf[b & a->mask], x);
+    aw_fence_rel();
+    aw_store_rlx(&q->bottom.value, b + 1);
+    return true;
+}
+
+// 从底部取出 (仅所有者)，为空时返回 NULL
+AW_INLINE void* aw_ws_deque_take(aw_ws_deque_t* q) {
+    long long b = aw_load_rlx(&q->bottom.value) - 1;
+    _aw_ws_array_t* a = (_aw_ws_array_t*)aw_load_rlx(&q->array.value);
+    long long t;
+    void* x = NULL;
+
+    aw_store_rlx(&q->bottom.value, b);
+    // 先公开 bottom 的减小再读取 top，与 steal 中 "读 top -> 屏障 -> 读 bottom" 配对
+    aw_fence_seq();
+    t = aw_load_rlx(&q->top.value);
+    if (t <= b) {
+        x = (void*)aw_load_rlx(&a->buf[b & a->mask]);
+        if (t == b) {
+            // 最后一个元素: 与窃取者竞争
+            if (!aw_cas(&q->top.value, &t, t + 1, AW_MO_SEQ_CST, AW_MO_RELAXED)) {
+                x = NULL;
+            }
+            aw_store_rlx(&q->bottom.value, b + 1);
+        }
+    } else {
+        aw_store_rlx(&q->bottom.value, b + 1);
+    }
+    return x;
+}
+
+// 从顶部窃取 (任意线程)，为空或与其他线程竞争失败时返回 NULL
+AW_INLINE void* aw_ws_deque_steal(aw_ws_deque_t* q) {
+    long long t = aw_load_acq(&q->top.value);
+    long long b;
+    void* x = NULL;
+
+    aw_fence_seq();
+    b = aw_load_acq(&q->bottom.value);
+    if (t < b) {
+        _aw_ws_array_t* a = (_aw_ws_array_t*)aw_load_acq(&q->array.value);
+        x = (void*)aw_load_rlx(&a->buf[t & a->mask]);
+        if (!aw_cas(&q->top.value, &t, t + 1, AW_MO_SEQ_CST, AW_MO_RELAXED)) {
+            return NULL;
+        }
+    }
+    return x;
+}
+
+// 元素个数的近似值
+AW_INLINE long long aw_ws_deque_size(aw_ws_deque_t* q) {
+    long long b = aw_load_rlx(&q->bottom.value);
+    long long t = aw_load_rlx(&q->top.value);
+    return b > t ? b - t : 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AW_WS_DEQUE_H
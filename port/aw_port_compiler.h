@@ -33,6 +33,21 @@ extern "C"
 
 
 
+// 处理器架构检测 (用于自旋提示等与指令集相关的实现)
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+    #define AW_ARCH_X86
+    #define AW_ARCH_X86_64
+#elif defined(__i386__) || defined(_M_IX86)
+    #define AW_ARCH_X86
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define AW_ARCH_ARM
+    #define AW_ARCH_ARM64
+#elif defined(__arm__) || defined(_M_ARM) || defined(__CC_ARM)
+    #define AW_ARCH_ARM
+#elif defined(__riscv)
+    #define AW_ARCH_RISCV
+#endif
+
 #define AW_STR_HELPER(x) #x
 #define AW_STR(x) AW_STR_HELPER(x)
 
@@ -51,6 +66,17 @@ extern "C"
     #define AW_NOTE(msg)
 #endif
 
+// 线程局部存储 (不支持的编译器上退化为普通静态存储，仅适用于单线程环境)
+#if defined(_MSC_VER)
+    #define AW_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define AW_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+    #define AW_THREAD_LOCAL _Thread_local
+#else
+    #define AW_THREAD_LOCAL
+#endif
+
 #if defined(__ARMCC_VERSION) /* ARM Compiler */
     #define __port_attribute(x) __attribute__(x)
     #define __port_used         __port_attribute((used))
@@ -63,6 +89,34 @@ extern "C"
     #else
         #define __port_packed __packed
     #endif
+#elif defined(__GNUC__) || defined(__clang__) /* GCC / Clang */
+    #define __port_attribute(x) __attribute__(x)
+    #define __port_used         __port_attribute((used))
+    #define __port_weak         __port_attribute((weak))
+    #define __port_section(x)   __port_attribute((section(x)))
+    #define __port_align(n)     __port_attribute((aligned(n)))
+    #define __port_packed       __port_attribute((packed))
+#elif defined(_MSC_VER) /* MSVC */
+    #define __port_align(n)     __declspec(align(n))
+#endif
+
+/*
+ * 对齐修饰 __port_align(n) 的可移植写法是放在 struct 关键字与结构体名/左花括号之间:
+ *   typedef struct __port_align(64) { ... } foo_t;
+ * n 必须是整数字面量 (MSVC 要求)。未知编译器上为空，此时只能依赖手工填充。
+ */
+#ifndef __port_align
+    #define __port_align(n)
+#endif
+
+/*
+ * 弱符号 __port_weak 用于头文件中定义、需要在所有编译单元之间共享一份的全局变量
+ * (aw_wait.h 的停车表、aw_profile.h 的统计表链表)。它不能退化为空: 否则每个
+ * 编译单元各自定义一份 (或链接时重复定义)，跨编译单元的等待 / 唤醒会互相看不见。
+ * MSVC 在使用处改用 __declspec(selectany)，其他编译器必须提供等价的弱符号。
+ */
+#if !defined(__port_weak) && !defined(_MSC_VER)
+    #error "port/compiler: [Err]: __port_weak (weak symbol attribute) is not defined for this compiler"
 #endif
 
 
@@ -0,0 +1,222 @@
+#ifndef AW_BENCH_H
+#define AW_BENCH_H
+
+// 绑核需要 pthread_setaffinity_np，本头文件必须在任何系统头文件之前包含
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+#endif
+
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+
+#include "aw_test.h"
+#include "aw_atomic_simple.h"
+
+/*
+ * ============================================================================
+ * AW Bench Helpers (基准辅助)
+ * ============================================================================
+ * 每个 bench_*.c 是一个独立程序，结果逐行输出为 CSV (默认) 或 JSON 数组，
+ * 列固定为:
+ *   backend,bench,op,order,width,threads,layout,iters,ns_per_op,ops_per_sec
+ * ns_per_op 为单个线程看到的每次操作耗时，ops_per_sec 为全部线程的总吞吐
+ * (一次操作由全部线程协作完成的基准，如 fork/join，另在文件开头说明)。
+ * 线程 i 绑定到 CPU (i % 在线 CPU 数) (仅 Linux)。
+ *
+ * 命令行参数:
+ *   -f csv|json  输出格式
+ *   -t N         最大线程数，依次测 1, 2, 4, ... N (默认为在线 CPU 数)
+ *   -n N         每个线程的迭代次数 (协作型基准中为总工作量)
+ */
+
+typedef struct {
+    int  json;          // 0: CSV, 1: JSON
+    int  max_threads;
+    long iters;
+    int  rows;          // 已输出的行数 (JSON 分隔符用)
+} aw_bench_opts_t;
+
+// 线程体: 对 ctx 执行 iters 次被测操作，id 为线程编号
+typedef void (*aw_bench_fn)(void* ctx, int id, long iters);
+
+AW_INLINE int aw_bench_cpus(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+
+AW_INLINE unsigned long long aw_bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ull + (unsigned long long)ts.tv_nsec;
+}
+
+AW_INLINE const char* aw_bench_backend(void) {
+#if AW_BACKEND == AW_BACKEND_STDATOMIC
+    return "stdatomic";
+#elif AW_BACKEND == AW_BACKEND_GCC_BUILTIN
+    return "gcc_builtin";
+#elif AW_BACKEND == AW_BACKEND_GENERIC
+    return "generic";
+#else
+    return "msvc";
+#endif
+}
+
+AW_INLINE void aw_bench_usage(const char* prog) {
+    fprintf(stderr, "usage: %s [-f csv|json] [-t max_threads] [-n iters]\n", prog);
+    exit(2);
+}
+
+AW_INLINE void aw_bench_parse(aw_bench_opts_t* o, int argc, char** argv, long default_iters) {
+    int i;
+
+    o->json        = 0;
+    o->max_threads = aw_bench_cpus();
+    o->iters       = default_iters;
+    o->rows        = 0;
+    for (i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            aw_bench_usage(argv[0]);
+        }
+        if (strcmp(argv[i], "-f") == 0) {
+            o->json = strcmp(argv[++i], "json") == 0;
+        } else if (strcmp(argv[i], "-t") == 0) {
+            o->max_threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-n") == 0) {
+            o->iters = atol(argv[++i]);
+        } else {
+            aw_bench_usage(argv[0]);
+        }
+    }
+    if (o->max_threads < 1 || o->max_threads > AW_TEST_MAX_THREADS || o->iters < 1) {
+        aw_bench_usage(argv[0]);
+    }
+}
+
+// 线程数序列 1, 2, 4, ...，最后一项为 max_threads 本身
+AW_INLINE int aw_bench_next_threads(const aw_bench_opts_t* o, int threads) {
+    if (threads >= o->max_threads) {
+        return 0;
+    }
+    return threads * 2 < o->max_threads ? threads * 2 : o->max_threads;
+}
+
+// ============================================================================
+// 运行
+// ============================================================================
+
+typedef struct {
+    aw_bench_fn        fn;
+    void*              ctx;
+    long               iters;
+    aw_atomic_int_t    ready;
+    aw_atomic_int_t    go;
+    unsigned long long end_ns[AW_TEST_MAX_THREADS];
+} _aw_bench_run_t;
+
+typedef struct {
+    _aw_bench_run_t* run;
+    int              id;
+} _aw_bench_thread_t;
+
+AW_INLINE void* _aw_bench_thread(void* arg) {
+    _aw_bench_thread_t* t = (_aw_bench_thread_t*)arg;
+    _aw_bench_run_t*    r = t->run;
+
+#if defined(__linux__)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(t->id % aw_bench_cpus(), &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+#endif
+    aw_fetch_add(&r->ready, 1, AW_MO_RELEASE);
+    while (!aw_load_acq(&r->go)) {
+        sched_yield();
+    }
+    r->fn(r->ctx, t->id, r->iters);
+    r->end_ns[t->id] = aw_bench_now_ns();
+    return NULL;
+}
+
+// n 个线程同时开始执行 fn，返回从放行到最后一个线程结束的耗时 (ns)
+AW_INLINE unsigned long long aw_bench_run(int n, aw_bench_fn fn, void* ctx, long iters) {
+    _aw_bench_run_t    r;
+    _aw_bench_thread_t t[AW_TEST_MAX_THREADS];
+    pthread_t          tid[AW_TEST_MAX_THREADS];
+    unsigned long long start, end = 0;
+    int i;
+
+    AW_TEST_CHECK(n > 0 && n <= AW_TEST_MAX_THREADS);
+    r.fn    = fn;
+    r.ctx   = ctx;
+    r.iters = iters;
+    aw_store(&r.ready, 0, AW_MO_RELAXED);
+    aw_store(&r.go, 0, AW_MO_RELAXED);
+    for (i = 0; i < n; i++) {
+        t[i].run = &r;
+        t[i].id  = i;
+        AW_TEST_CHECK(pthread_create(&tid[i], NULL, _aw_bench_thread, &t[i]) == 0);
+    }
+    while (aw_load_acq(&r.ready) != n) {
+        sched_yield();
+    }
+    start = aw_bench_now_ns();
+    aw_store_rel(&r.go, 1);
+    for (i = 0; i < n; i++) {
+        AW_TEST_CHECK(pthread_join(tid[i], NULL) == 0);
+        if (r.end_ns[i] > end) {
+            end = r.end_ns[i];
+        }
+    }
+    return end > start ? end - start : 1;
+}
+
+// ============================================================================
+// 输出
+// ============================================================================
+
+AW_INLINE void aw_bench_begin(aw_bench_opts_t* o) {
+    if (o->json) {
+        printf("[\n");
+    } else {
+        printf("backend,bench,op,order,width,threads,layout,iters,ns_per_op,ops_per_sec\n");
+    }
+}
+
+// 直接给出 ns_per_op 与 ops_per_sec (操作不是 "每线程 iters 次" 时使用，如 fork/join)
+AW_INLINE void aw_bench_emit(aw_bench_opts_t* o, const char* bench, const char* op,
+                             const char* order, int width, int threads, const char* layout,
+                             long iters, double ns_per_op, double ops_per_sec) {
+    if (o->json) {
+        printf("%s  {\"backend\": \"%s\", \"bench\": \"%s\", \"op\": \"%s\", \"order\": \"%s\", "
+               "\"width\": %d, \"threads\": %d, \"layout\": \"%s\", \"iters\": %ld, "
+               "\"ns_per_op\": %.3f, \"ops_per_sec\": %.0f}",
+               o->rows ? ",\n" : "", aw_bench_backend(), bench, op, order, width, threads,
+               layout, iters, ns_per_op, ops_per_sec);
+    } else {
+        printf("%s,%s,%s,%s,%d,%d,%s,%ld,%.3f,%.0f\n", aw_bench_backend(), bench, op, order,
+               width, threads, layout, iters, ns_per_op, ops_per_sec);
+    }
+    o->rows++;
+    fflush(stdout);
+}
+
+// 每个线程各执行 iters 次操作，耗时 elapsed_ns。width 为 0 表示与宽度无关 (如屏障)
+AW_INLINE void aw_bench_row(aw_bench_opts_t* o, const char* bench, const char* op,
+                            const char* order, int width, int threads, const char* layout,
+                            long iters, unsigned long long elapsed_ns) {
+    aw_bench_emit(o, bench, op, order, width, threads, layout, iters,
+                  (double)elapsed_ns / (double)iters,
+                  (double)threads * (double)iters * 1e9 / (double)elapsed_ns);
+}
+
+AW_INLINE void aw_bench_end(aw_bench_opts_t* o) {
+    if (o->json) {
+        printf("%s]\n", o->rows ? "\n" : "");
+    }
+}
+
+#endif // AW_BENCH_H
@@ -0,0 +1,55 @@
+#ifndef AW_TEST_H
+#define AW_TEST_H
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "aw_atomic_base.h"
+
+/*
+ * ============================================================================
+ * AW Test Helpers (测试辅助)
+ * ============================================================================
+ * 每个 test_*.c 是一个独立程序，失败时打印位置并以非 0 退出，成功时打印 PASS。
+ */
+
+#define AW_TEST_CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define AW_TEST_PASS(name) \
+    do { \
+        printf("PASS %s\n", name); \
+        return 0; \
+    } while (0)
+
+#define AW_TEST_MAX_THREADS 64
+
+// 公平锁 (ticket/MCS) 在单核上每次交接都要等一个调度时间片，
+// 迭代次数按 CPU 数缩放: 多核取 many，单核取 few
+AW_INLINE int aw_test_iters(int many, int few) {
+    return sysconf(_SC_NPROCESSORS_ONLN) > 1 ? many : few;
+}
+
+// 启动 n 个线程执行 fn((void*)(intptr_t)i)，并等待全部结束
+AW_INLINE void aw_test_run_threads(int n, void* (*fn)(void*)) {
+    pthread_t tid[AW_TEST_MAX_THREADS];
+    int i;
+
+    AW_TEST_CHECK(n > 0 && n <= AW_TEST_MAX_THREADS);
+    for (i = 0; i < n; i++) {
+        AW_TEST_CHECK(pthread_create(&tid[i], NULL, fn, (void*)(intptr_t)i) == 0);
+    }
+    for (i = 0; i < n; i++) {
+        AW_TEST_CHECK(pthread_join(tid[i], NULL) == 0);
+    }
+}
+
+#endif // AW_TEST_H
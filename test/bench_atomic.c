@@ -0,0 +1,169 @@
+#include "aw_bench.h"
+
+/*
+ * aw_atomic.h / aw_atomic_simple.h 各操作在每种内存序、8/16/32/64 位宽度下的耗时
+ * (aw_fetch_max/min 与位操作只支持 int 及以上宽度，只测 32/64 位)。
+ * 多线程时分两种布局:
+ *   shared  全部线程操作同一个原子变量 (同一缓存行，测竞争)
+ *   padded  每个线程操作自己独占缓存行的变量 (测无伪共享时的扩展性)
+ * 单线程记为 single，屏障不访问共享数据，多线程时记为 private。
+ */
+
+static aw_padded_atomic_uchar_t  slots8[AW_TEST_MAX_THREADS];
+static aw_padded_atomic_ushort_t slots16[AW_TEST_MAX_THREADS];
+static aw_padded_atomic_uint_t   slots32[AW_TEST_MAX_THREADS];
+static aw_padded_atomic_ullong_t slots64[AW_TEST_MAX_THREADS];
+
+// 防止读取结果被优化掉
+static volatile unsigned long long sink;
+
+typedef struct {
+    const char* op;
+    const char* order;
+    int         width;      // 0: 与宽度无关
+    void      (*fn)(void* target, long iters);
+} bench_op_t;
+
+// X(W, T, id, op, order, body): body 中可用 p (T*)、i (循环变量)、e (CAS 期望值)、s (累加)
+#define BENCH_INT_OPS(X, W, T) \
+    X(W, T, load_rlx,       "aw_load_rlx",         "relaxed", s += aw_load_rlx(p)) \
+    X(W, T, load_acq,       "aw_load_acq",         "acquire", s += aw_load_acq(p)) \
+    X(W, T, load_seq,       "aw_load",             "seq_cst", s += aw_load(p, AW_MO_SEQ_CST)) \
+    X(W, T, store_rlx,      "aw_store_rlx",        "relaxed", aw_store_rlx(p, (T)i)) \
+    X(W, T, store_rel,      "aw_store_rel",        "release", aw_store_rel(p, (T)i)) \
+    X(W, T, store_seq,      "aw_store",            "seq_cst", aw_store(p, (T)i, AW_MO_SEQ_CST)) \
+    X(W, T, swap_rlx,       "aw_swap_rlx",         "relaxed", s += aw_swap_rlx(p, (T)i)) \
+    X(W, T, swap_acq,       "aw_swap_acq",         "acquire", s += aw_swap_acq(p, (T)i)) \
+    X(W, T, swap_rel,       "aw_swap_rel",         "release", s += aw_swap_rel(p, (T)i)) \
+    X(W, T, swap_ar,        "aw_swap_ar",          "acq_rel", s += aw_swap_ar(p, (T)i)) \
+    X(W, T, swap_seq,       "aw_exchange",         "seq_cst", s += aw_exchange(p, (T)i, AW_MO_SEQ_CST)) \
+    X(W, T, cas_rlx,        "aw_cas_rlx",          "relaxed", s += aw_cas_rlx(p, &e, (T)(e + 1))) \
+    X(W, T, cas_acq,        "aw_cas_acq",          "acquire", s += aw_cas_acq(p, &e, (T)(e + 1))) \
+    X(W, T, cas_rel,        "aw_cas_rel",          "release", s += aw_cas_rel(p, &e, (T)(e + 1))) \
+    X(W, T, cas_ar,         "aw_cas_ar",           "acq_rel", s += aw_cas_ar(p, &e, (T)(e + 1))) \
+    X(W, T, cas_seq,        "aw_cas",              "seq_cst", s += aw_cas(p, &e, (T)(e + 1), AW_MO_SEQ_CST, AW_MO_SEQ_CST)) \
+    X(W, T, cas_weak_rlx,   "aw_cas_weak_rlx",     "relaxed", s += aw_cas_weak_rlx(p, &e, (T)(e + 1))) \
+    X(W, T, cas_weak_ar,    "aw_cas_weak_ar",      "acq_rel", s += aw_cas_weak_ar(p, &e, (T)(e + 1))) \
+    X(W, T, faa_rlx,        "aw_faa_rlx",          "relaxed", s += aw_faa_rlx(p, 1)) \
+    X(W, T, faa_acq,        "aw_faa_acq",          "acquire", s += aw_faa_acq(p, 1)) \
+    X(W, T, faa_rel,        "aw_faa_rel",          "release", s += aw_faa_rel(p, 1)) \
+    X(W, T, faa_ar,         "aw_faa_ar",           "acq_rel", s += aw_faa_ar(p, 1)) \
+    X(W, T, faa_seq,        "aw_fetch_add",        "seq_cst", s += aw_fetch_add(p, 1, AW_MO_SEQ_CST)) \
+    X(W, T, fas_rlx,        "aw_fas_rlx",          "relaxed", s += aw_fas_rlx(p, 1)) \
+    X(W, T, fas_ar,         "aw_fas_ar",           "acq_rel", s += aw_fas_ar(p, 1)) \
+    X(W, T, inc_rlx,        "aw_inc_rlx",          "relaxed", s += aw_inc_rlx(p)) \
+    X(W, T, inc_ar,         "aw_inc_ar",           "acq_rel", s += aw_inc_ar(p)) \
+    X(W, T, fand_rlx,       "aw_fand_rlx",         "relaxed", s += aw_fand_rlx(p, (T)~(T)1)) \
+    X(W, T, fand_ar,        "aw_fand_ar",          "acq_rel", s += aw_fand_ar(p, (T)~(T)1)) \
+    X(W, T, for_rlx,        "aw_for_rlx",          "relaxed", s += aw_for_rlx(p, (T)1)) \
+    X(W, T, for_ar,         "aw_for_ar",           "acq_rel", s += aw_for_ar(p, (T)1)) \
+    X(W, T, fxor_rlx,       "aw_fxor_rlx",         "relaxed", s += aw_fxor_rlx(p, (T)1)) \
+    X(W, T, fxor_ar,        "aw_fxor_ar",          "acq_rel", s += aw_fxor_ar(p, (T)1))
+
+// 只支持 int 及以上宽度的操作
+#define BENCH_WIDE_OPS(X, W, T) \
+    X(W, T, fetch_max,      "aw_fetch_max",        "acq_rel", s += aw_fetch_max(p, (T)i, AW_MO_ACQ_REL)) \
+    X(W, T, fetch_min,      "aw_fetch_min",        "acq_rel", s += aw_fetch_min(p, (T)~(T)i, AW_MO_ACQ_REL)) \
+    X(W, T, bts,            "aw_bit_test_and_set", "acq_rel", s += aw_bit_test_and_set(p, (unsigned int)i % W, AW_MO_ACQ_REL))
+
+#define BENCH_FENCE_OPS(X) \
+    X(fence_acq,        "aw_fence_acq",        "acquire", aw_fence_acq()) \
+    X(fence_rel,        "aw_fence_rel",        "release", aw_fence_rel()) \
+    X(fence_ar,         "aw_fence_ar",         "acq_rel", aw_fence_ar()) \
+    X(fence_seq,        "aw_fence_seq",        "seq_cst", aw_fence_seq()) \
+    X(compiler_barrier, "aw_compiler_barrier", "acq_rel", aw_compiler_barrier())
+
+#define BENCH_DEFINE_INT(W, T, id, op, order, body) \
+    static void bench_##id##_##W(void* target, long iters) { \
+        T* p = (T*)target; \
+        long i; \
+        unsigned long long s = 0; \
+        __typeof__(aw_load(p, AW_MO_RELAXED)) e = 0; \
+        (void)e; \
+        for (i = 0; i < iters; i++) { \
+            body; \
+        } \
+        sink = s; \
+    }
+
+#define BENCH_DEFINE_FENCE(id, op, order, body) \
+    static void bench_##id(void* target, long iters) { \
+        long i; \
+        (void)target; \
+        for (i = 0; i < iters; i++) { \
+            body; \
+        } \
+    }
+
+#define BENCH_ENTRY_INT(W, T, id, op, order, body) { op, order, W, bench_##id##_##W },
+#define BENCH_ENTRY_FENCE(id, op, order, body)     { op, order, 0, bench_##id },
+
+BENCH_INT_OPS(BENCH_DEFINE_INT, 8, aw_atomic_uchar_t)
+BENCH_INT_OPS(BENCH_DEFINE_INT, 16, aw_atomic_ushort_t)
+BENCH_INT_OPS(BENCH_DEFINE_INT, 32, aw_atomic_uint_t)
+BENCH_INT_OPS(BENCH_DEFINE_INT, 64, aw_atomic_ullong_t)
+BENCH_WIDE_OPS(BENCH_DEFINE_INT, 32, aw_atomic_uint_t)
+BENCH_WIDE_OPS(BENCH_DEFINE_INT, 64, aw_atomic_ullong_t)
+BENCH_FENCE_OPS(BENCH_DEFINE_FENCE)
+
+static const bench_op_t ops[] = {
+    BENCH_INT_OPS(BENCH_ENTRY_INT, 8, aw_atomic_uchar_t)
+    BENCH_INT_OPS(BENCH_ENTRY_INT, 16, aw_atomic_ushort_t)
+    BENCH_INT_OPS(BENCH_ENTRY_INT, 32, aw_atomic_uint_t)
+    BENCH_INT_OPS(BENCH_ENTRY_INT, 64, aw_atomic_ullong_t)
+    BENCH_WIDE_OPS(BENCH_ENTRY_INT, 32, aw_atomic_uint_t)
+    BENCH_WIDE_OPS(BENCH_ENTRY_INT, 64, aw_atomic_ullong_t)
+    BENCH_FENCE_OPS(BENCH_ENTRY_FENCE)
+};
+
+typedef struct {
+    const bench_op_t* op;
+    int               padded;
+} bench_ctx_t;
+
+static void* target_of(const bench_op_t* op, int slot) {
+    switch (op->width) {
+    case 8:
+        return (void*)&slots8[slot].value;
+    case 16:
+        return (void*)&slots16[slot].value;
+    case 32:
+        return (void*)&slots32[slot].value;
+    default:
+        return (void*)&slots64[slot].value;
+    }
+}
+
+static void bench_thread(void* ctx, int id, long iters) {
+    bench_ctx_t* c = (bench_ctx_t*)ctx;
+
+    c->op->fn(target_of(c->op, c->padded ? id : 0), iters);
+}
+
+int main(int argc, char** argv) {
+    aw_bench_opts_t opts;
+    size_t k;
+    int threads, padded;
+
+    aw_bench_parse(&opts, argc, argv, 1000000);
+    aw_bench_begin(&opts);
+    for (k = 0; k < sizeof(ops) / sizeof(ops[0]); k++) {
+        for (threads = 1; threads; threads = aw_bench_next_threads(&opts, threads)) {
+            // 单线程时两种布局相同，只测一次；屏障不访问变量，同理
+            for (padded = 0; padded < (threads > 1 && ops[k].width ? 2 : 1); padded++) {
+                bench_ctx_t ctx;
+                unsigned long long ns;
+
+                ctx.op     = &ops[k];
+                ctx.padded = padded;
+                ns = aw_bench_run(threads, bench_thread, &ctx, opts.iters);
+                aw_bench_row(&opts, "atomic", ops[k].op, ops[k].order, ops[k].width, threads,
+                             threads == 1 ? "single" :
+                             !ops[k].width ? "private" : (padded ? "padded" : "shared"),
+                             opts.iters, ns);
+            }
+        }
+    }
+    aw_bench_end(&opts);
+    return 0;
+}
@@ -0,0 +1,129 @@
+#include "aw_bench.h"
+
+/*
+ * 双字 CAS (aw_cas_dw，64 位平台上为 cmpxchg16b / CASP 或 libatomic) 与
+ * 单字 64 位 aw_cas 的单次代价对比，以及对应的读取 (aw_load_dw / aw_load)。
+ * 每次 CAS 都以上一次的结果为期望值，无竞争时总是成功；多线程时分 shared
+ * (同一个变量) 与 padded (每个线程独占缓存行) 两种布局，同 bench_atomic。
+ * 没有双字 CAS 的后端 (AW_HAS_DW_CAS 未定义，如 __sync 通用回退) 只输出表头。
+ */
+
+#ifdef AW_HAS_DW_CAS
+
+_AW_PADDED_ATOMIC(padded_dw_t, aw_atomic_dw_t);
+
+static padded_dw_t               dw_slots[AW_TEST_MAX_THREADS];
+static aw_padded_atomic_ullong_t u64_slots[AW_TEST_MAX_THREADS];
+
+static volatile unsigned long long sink;
+
+static void bench_cas_dw(void* target, long iters) {
+    aw_atomic_dw_t* p = (aw_atomic_dw_t*)target;
+    aw_dw_t e = aw_load_dw(p, AW_MO_RELAXED);
+    unsigned long long s = 0;
+    long i;
+
+    for (i = 0; i < iters; i++) {
+        aw_dw_t d;
+
+        d.lo = e.lo + 1;
+        d.hi = e.hi + 2;
+        s += aw_cas_dw(p, &e, d, AW_MO_ACQ_REL, AW_MO_RELAXED);
+    }
+    sink = s;
+}
+
+static void bench_cas_u64(void* target, long iters) {
+    aw_atomic_ullong_t* p = (aw_atomic_ullong_t*)target;
+    unsigned long long e = aw_load_rlx(p);
+    unsigned long long s = 0;
+    long i;
+
+    for (i = 0; i < iters; i++) {
+        s += aw_cas(p, &e, e + 1, AW_MO_ACQ_REL, AW_MO_RELAXED);
+    }
+    sink = s;
+}
+
+static void bench_load_dw(void* target, long iters) {
+    aw_atomic_dw_t* p = (aw_atomic_dw_t*)target;
+    unsigned long long s = 0;
+    long i;
+
+    for (i = 0; i < iters; i++) {
+        s += aw_load_dw(p, AW_MO_ACQUIRE).lo;
+    }
+    sink = s;
+}
+
+static void bench_load_u64(void* target, long iters) {
+    aw_atomic_ullong_t* p = (aw_atomic_ullong_t*)target;
+    unsigned long long s = 0;
+    long i;
+
+    for (i = 0; i < iters; i++) {
+        s += aw_load_acq(p);
+    }
+    sink = s;
+}
+
+typedef struct {
+    const char* op;
+    const char* order;
+    int         width;
+    void      (*fn)(void* target, long iters);
+} bench_op_t;
+
+static const bench_op_t ops[] = {
+    { "aw_cas_dw",   "acq_rel", AW_DW_SIZE * 8, bench_cas_dw },
+    { "aw_cas",      "acq_rel", 64,             bench_cas_u64 },
+    { "aw_load_dw",  "acquire", AW_DW_SIZE * 8, bench_load_dw },
+    { "aw_load_acq", "acquire", 64,             bench_load_u64 },
+};
+
+typedef struct {
+    const bench_op_t* op;
+    int               padded;
+} bench_ctx_t;
+
+static void bench_thread(void* ctx, int id, long iters) {
+    bench_ctx_t* c = (bench_ctx_t*)ctx;
+    int slot = c->padded ? id : 0;
+
+    c->op->fn(c->op->width == 64 ? (void*)&u64_slots[slot].value : (void*)&dw_slots[slot].value,
+              iters);
+}
+
+#endif // AW_HAS_DW_CAS
+
+int main(int argc, char** argv) {
+    aw_bench_opts_t opts;
+
+    aw_bench_parse(&opts, argc, argv, 1000000);
+    aw_bench_begin(&opts);
+#ifdef AW_HAS_DW_CAS
+    {
+        size_t k;
+        int threads, padded;
+
+        for (k = 0; k < sizeof(ops) / sizeof(ops[0]); k++) {
+            for (threads = 1; threads; threads = aw_bench_next_threads(&opts, threads)) {
+                // 单线程时两种布局相同，只测一次
+                for (padded = 0; padded < (threads > 1 ? 2 : 1); padded++) {
+                    bench_ctx_t ctx;
+                    unsigned long long ns;
+
+                    ctx.op     = &ops[k];
+                    ctx.padded = padded;
+                    ns = aw_bench_run(threads, bench_thread, &ctx, opts.iters);
+                    aw_bench_row(&opts, "dw_cas", ops[k].op, ops[k].order, ops[k].width, threads,
+                                 threads == 1 ? "single" : (padded ? "padded" : "shared"),
+                                 opts.iters, ns);
+                }
+            }
+        }
+    }
+#endif
+    aw_bench_end(&opts);
+    return 0;
+}
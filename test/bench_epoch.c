@@ -0,0 +1,135 @@
+#include "aw_bench.h"
+#include "aw_epoch.h"
+#include "aw_mutex.h"
+
+/*
+ * 读多写少的 "键 -> 值" 表，两种保护方式:
+ *   epoch   每个键指向一个不可变的值对象，读者在 aw_epoch 临界区内读取；
+ *           写者分配新对象、原子替换指针，旧对象经 aw_epoch_retire 回收
+ *   mutex   值直接存放在表中，读写都取同一把 aw_mutex
+ * 写比例为 0% 与 1%。如需 1..64 线程的完整曲线，运行时传 -t 64。
+ */
+
+#define KEYS 1024
+
+typedef struct {
+    aw_epoch_node_t ep;
+    unsigned long   value;
+} val_t;
+
+static aw_epoch_domain_t dom;
+static aw_atomic_ptr_t   emap[KEYS];
+
+static aw_mutex_t    amutex = AW_MUTEX_INIT;
+static unsigned long mmap_vals[KEYS];
+
+static volatile unsigned long sink;
+
+static val_t* val_new(unsigned long value) {
+    val_t* v = (val_t*)malloc(sizeof(val_t));
+
+    AW_TEST_CHECK(v != NULL);
+    v->value = value;
+    return v;
+}
+
+// 每个线程独立的伪随机序列
+static unsigned int next_rand(unsigned int* s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+// 每 1000 次操作中有 ctx 指向的次数为写
+static void bench_epoch_map(void* ctx, int id, long iters) {
+    unsigned int writes = *(const unsigned int*)ctx;
+    unsigned int seed = 2463534242u + (unsigned int)id * 40503u;
+    aw_epoch_rec_t* rec = aw_epoch_acquire(&dom);
+    unsigned long s = 0;
+    long i;
+
+    AW_TEST_CHECK(rec != NULL);
+    for (i = 0; i < iters; i++) {
+        unsigned int r = next_rand(&seed);
+        aw_atomic_ptr_t* slot = &emap[r % KEYS];
+
+        if ((r >> 10) % 1000u < writes) {
+            val_t* old = (val_t*)aw_swap_ar(slot, (void*)val_new((unsigned long)i));
+            aw_epoch_retire(&dom, rec, old, &old->ep, free);
+        } else {
+            aw_epoch_enter(&dom, rec);
+            s += ((val_t*)aw_load_acq(slot))->value;
+            aw_epoch_exit(&dom, rec);
+        }
+    }
+    aw_epoch_release(rec);
+    sink = s;
+}
+
+static void bench_mutex_map(void* ctx, int id, long iters) {
+    unsigned int writes = *(const unsigned int*)ctx;
+    unsigned int seed = 2463534242u + (unsigned int)id * 40503u;
+    unsigned long s = 0;
+    long i;
+
+    for (i = 0; i < iters; i++) {
+        unsigned int r = next_rand(&seed);
+
+        aw_mutex_lock(&amutex);
+        if ((r >> 10) % 1000u < writes) {
+            mmap_vals[r % KEYS] = (unsigned long)i;
+        } else {
+            s += mmap_vals[r % KEYS];
+        }
+        aw_mutex_unlock(&amutex);
+    }
+    sink = s;
+}
+
+typedef struct {
+    const char* op;
+    aw_bench_fn fn;
+} bench_op_t;
+
+static const bench_op_t ops[] = {
+    { "epoch_map", bench_epoch_map },
+    { "mutex_map", bench_mutex_map },
+};
+
+// 每 1000 次中的写次数，与名称一一对应
+static const unsigned int writes[] = { 0, 10 };
+static const char* const  mixes[]  = { "read100", "read99" };
+
+int main(int argc, char** argv) {
+    aw_bench_opts_t opts;
+    size_t k, m;
+    int i, threads;
+
+    aw_epoch_domain_init(&dom, 0);
+    for (i = 0; i < KEYS; i++) {
+        aw_store_rlx(&emap[i], (void*)val_new((unsigned long)i));
+    }
+    aw_bench_parse(&opts, argc, argv, 1000000);
+    aw_bench_begin(&opts);
+    for (m = 0; m < sizeof(writes) / sizeof(writes[0]); m++) {
+        for (k = 0; k < sizeof(ops) / sizeof(ops[0]); k++) {
+            for (threads = 1; threads; threads = aw_bench_next_threads(&opts, threads)) {
+                char op[64];
+                unsigned int w = writes[m];
+                unsigned long long ns = aw_bench_run(threads, ops[k].fn, &w, opts.iters);
+
+                // 两轮之间没有读者，遗留的退休对象可以全部回收
+                aw_epoch_domain_drain(&dom);
+                snprintf(op, sizeof(op), "%s_%s", ops[k].op, mixes[m]);
+                aw_bench_row(&opts, "epoch", op, "acq_rel", 0, threads,
+                             threads == 1 ? "single" : "shared", opts.iters, ns);
+            }
+        }
+    }
+    aw_bench_end(&opts);
+    for (i = 0; i < KEYS; i++) {
+        free((val_t*)aw_load_rlx(&emap[i]));
+    }
+    return 0;
+}
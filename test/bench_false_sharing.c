@@ -0,0 +1,89 @@
+#include "aw_bench.h"
+
+/*
+ * 两个计数器的伪共享: 线程 0 只写 a，线程 1 只写 b，两者没有任何逻辑上的共享。
+ *   shared  a、b 相邻 (同一条缓存行)，每次写入都要从对方手里抢回缓存行
+ *   padded  a、b 为 aw_padded_atomic_ullong_t，各占一条缓存行
+ * 1 线程一行作为基线 (只写 a)。写入分 RMW (aw_inc_rlx) 与普通原子写
+ * (aw_store_rlx) 两种，后者不需要 lock 前缀，更能看出缓存行往返的代价。
+ */
+
+static struct AW_CACHELINE_ALIGN {
+    aw_atomic_ullong_t a;
+    aw_atomic_ullong_t b;
+} adjacent;
+
+static struct {
+    aw_padded_atomic_ullong_t a;
+    aw_padded_atomic_ullong_t b;
+} padded;
+
+typedef struct {
+    void (*fn)(aw_atomic_ullong_t* p, long iters);
+    int  padded;
+} bench_ctx_t;
+
+static void bench_inc(aw_atomic_ullong_t* p, long iters) {
+    long i;
+
+    for (i = 0; i < iters; i++) {
+        aw_inc_rlx(p);
+    }
+}
+
+static void bench_store(aw_atomic_ullong_t* p, long iters) {
+    long i;
+
+    for (i = 0; i < iters; i++) {
+        aw_store_rlx(p, (unsigned long long)i);
+    }
+}
+
+static void bench_thread(void* ctx, int id, long iters) {
+    bench_ctx_t* c = (bench_ctx_t*)ctx;
+    aw_atomic_ullong_t* p;
+
+    if (c->padded) {
+        p = id == 0 ? &padded.a.value : &padded.b.value;
+    } else {
+        p = id == 0 ? &adjacent.a : &adjacent.b;
+    }
+    c->fn(p, iters);
+}
+
+typedef struct {
+    const char* op;
+    const char* order;
+    void      (*fn)(aw_atomic_ullong_t* p, long iters);
+} bench_op_t;
+
+static const bench_op_t ops[] = {
+    { "aw_inc_rlx",   "relaxed", bench_inc },
+    { "aw_store_rlx", "relaxed", bench_store },
+};
+
+int main(int argc, char** argv) {
+    aw_bench_opts_t opts;
+    size_t k;
+    int threads, layout;
+
+    aw_bench_parse(&opts, argc, argv, 10000000);
+    aw_bench_begin(&opts);
+    for (k = 0; k < sizeof(ops) / sizeof(ops[0]); k++) {
+        for (threads = 1; threads <= 2 && threads <= opts.max_threads; threads++) {
+            for (layout = 0; layout < (threads > 1 ? 2 : 1); layout++) {
+                bench_ctx_t ctx;
+                unsigned long long ns;
+
+                ctx.fn     = ops[k].fn;
+                ctx.padded = layout;
+                ns = aw_bench_run(threads, bench_thread, &ctx, opts.iters);
+                aw_bench_row(&opts, "false_sharing", ops[k].op, ops[k].order, 64, threads,
+                             threads == 1 ? "single" : (layout ? "padded" : "shared"),
+                             opts.iters, ns);
+            }
+        }
+    }
+    aw_bench_end(&opts);
+    return 0;
+}
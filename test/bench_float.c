@@ -0,0 +1,88 @@
+#include "aw_bench.h"
+#include "aw_atomic_float.h"
+
+/*
+ * 浮点累加 (CAS 循环) 在竞争下的开销，以整数 aw_faa_rlx 为对照。
+ * 布局含义同 bench_atomic.c: shared 为同一变量，padded 为每线程独占缓存行。
+ */
+
+typedef struct AW_CACHELINE_ALIGN {
+    aw_atomic_double_t f64;
+    aw_atomic_float_t  f32;
+    aw_atomic_ullong_t u64;
+} bench_slot_t;
+
+static bench_slot_t slots[AW_TEST_MAX_THREADS];
+
+typedef struct {
+    const char* op;
+    int         width;
+    void      (*fn)(bench_slot_t* slot, long iters);
+} bench_op_t;
+
+static void bench_add_f64(bench_slot_t* slot, long iters) {
+    long i;
+
+    for (i = 0; i < iters; i++) {
+        aw_fetch_add_f64(&slot->f64, 1.0, AW_MO_RELAXED);
+    }
+}
+
+static void bench_add_f32(bench_slot_t* slot, long iters) {
+    long i;
+
+    for (i = 0; i < iters; i++) {
+        aw_fetch_add_f32(&slot->f32, 1.0f, AW_MO_RELAXED);
+    }
+}
+
+static void bench_faa_u64(bench_slot_t* slot, long iters) {
+    long i;
+
+    for (i = 0; i < iters; i++) {
+        aw_faa_rlx(&slot->u64, 1);
+    }
+}
+
+static const bench_op_t ops[] = {
+    { "aw_fetch_add_f64", 64, bench_add_f64 },
+    { "aw_fetch_add_f32", 32, bench_add_f32 },
+    { "aw_faa_rlx",       64, bench_faa_u64 },
+};
+
+typedef struct {
+    const bench_op_t* op;
+    int               padded;
+} bench_ctx_t;
+
+static void bench_thread(void* ctx, int id, long iters) {
+    bench_ctx_t* c = (bench_ctx_t*)ctx;
+
+    c->op->fn(&slots[c->padded ? id : 0], iters);
+}
+
+int main(int argc, char** argv) {
+    aw_bench_opts_t opts;
+    size_t k;
+    int threads, padded;
+
+    aw_bench_parse(&opts, argc, argv, 1000000);
+    aw_bench_begin(&opts);
+    for (k = 0; k < sizeof(ops) / sizeof(ops[0]); k++) {
+        for (threads = 1; threads; threads = aw_bench_next_threads(&opts, threads)) {
+            for (padded = 0; padded < (threads > 1 ? 2 : 1); padded++) {
+                bench_ctx_t ctx;
+                unsigned long long ns;
+
+                ctx.op     = &ops[k];
+                ctx.padded = padded;
+                ns = aw_bench_run(threads, bench_thread, &ctx, opts.iters);
+                aw_bench_row(&opts, "float", ops[k].op, "relaxed", ops[k].width, threads,
+                             threads == 1 ? "single" : (padded ? "padded" : "shared"),
+                             opts.iters, ns);
+            }
+        }
+    }
+    aw_bench_end(&opts);
+    return 0;
+}
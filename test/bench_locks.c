@@ -0,0 +1,76 @@
+#include "aw_bench.h"
+#include "aw_spinlock.h"
+#include "aw_ticketlock.h"
+#include "aw_mcslock.h"
+
+/*
+ * 三种自旋锁在 1..N 线程争用同一把锁时的吞吐:
+ *   aw_spinlock     TAS (test-and-test-and-set + 退避)，所有等待者自旋同一个字
+ *   aw_ticketlock   FIFO，等待者自旋同一个 now_serving 字
+ *   aw_mcslock      FIFO，每个等待者自旋自己的队列节点
+ * 临界区只递增一个计数器。线程数超过在线 CPU 数时，FIFO 锁的每次交接都要等
+ * 被抢占的下一位等待者重新得到调度 (一个时间片)，测出来的只是调度周期，
+ * 因此这两种锁只测到 CPU 数为止。
+ */
+
+static aw_spinlock_t   spin   = AW_SPINLOCK_INIT;
+static aw_ticketlock_t ticket = AW_TICKETLOCK_INIT;
+static aw_mcslock_t    mcs    = AW_MCSLOCK_INIT;
+
+// 仅在锁内访问
+static volatile unsigned long counter;
+
+#define BENCH_LOCK(name, lock, unlock) \
+    static void name(void* ctx, int id, long iters) { \
+        aw_mcs_node_t node; \
+        long i; \
+        (void)ctx; \
+        (void)id; \
+        (void)node; \
+        for (i = 0; i < iters; i++) { \
+            lock; \
+            counter++; \
+            unlock; \
+        } \
+    }
+
+BENCH_LOCK(bench_spin,   aw_spinlock_lock(&spin),        aw_spinlock_unlock(&spin))
+BENCH_LOCK(bench_ticket, aw_ticketlock_lock(&ticket),    aw_ticketlock_unlock(&ticket))
+BENCH_LOCK(bench_mcs,    aw_mcslock_lock(&mcs, &node),   aw_mcslock_unlock(&mcs, &node))
+
+typedef struct {
+    const char* op;
+    aw_bench_fn fn;
+    int         fifo;
+} bench_op_t;
+
+static const bench_op_t ops[] = {
+    { "aw_spinlock",   bench_spin,   0 },
+    { "aw_ticketlock", bench_ticket, 1 },
+    { "aw_mcslock",    bench_mcs,    1 },
+};
+
+int main(int argc, char** argv) {
+    aw_bench_opts_t opts;
+    size_t k;
+    int threads;
+
+    aw_bench_parse(&opts, argc, argv, 200000);
+    aw_bench_begin(&opts);
+    for (k = 0; k < sizeof(ops) / sizeof(ops[0]); k++) {
+        for (threads = 1; threads; threads = aw_bench_next_threads(&opts, threads)) {
+            unsigned long before = counter;
+            unsigned long long ns;
+
+            if (ops[k].fifo && threads > aw_bench_cpus()) {
+                break;
+            }
+            ns = aw_bench_run(threads, ops[k].fn, NULL, opts.iters);
+            AW_TEST_CHECK(counter - before == (unsigned long)threads * (unsigned long)opts.iters);
+            aw_bench_row(&opts, "locks", ops[k].op, "acq_rel", 0, threads,
+                         threads == 1 ? "single" : "shared", opts.iters, ns);
+        }
+    }
+    aw_bench_end(&opts);
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include "aw_bench.h"
+#include "aw_mutex.h"
+
+/*
+ * aw_mutex 与 pthread_mutex 的对比: 单线程 (无竞争) 以及 2..N 线程争用同一把锁。
+ * 临界区分两种长度:
+ *   short  只递增一个计数器
+ *   long   约 LONG_HOLD 次依赖读写，模拟较长的持有时间 (触发自适应自旋/挂起)
+ * 如需 2..64 线程的完整曲线，运行时传 -t 64。
+ */
+
+#define LONG_HOLD 200
+
+static aw_mutex_t      amutex = AW_MUTEX_INIT;
+static pthread_mutex_t pmutex = PTHREAD_MUTEX_INITIALIZER;
+
+// 仅在锁内访问
+static volatile unsigned long counter;
+
+static void hold(int work) {
+    int i;
+
+    for (i = 0; i < work; i++) {
+        counter++;
+    }
+}
+
+#define BENCH_MUTEX(name, lock, unlock, work) \
+    static void name(void* ctx, int id, long iters) { \
+        long i; \
+        (void)ctx; \
+        (void)id; \
+        for (i = 0; i < iters; i++) { \
+            lock; \
+            hold(work); \
+            unlock; \
+        } \
+    }
+
+BENCH_MUTEX(bench_aw_short, aw_mutex_lock(&amutex), aw_mutex_unlock(&amutex), 1)
+BENCH_MUTEX(bench_aw_long,  aw_mutex_lock(&amutex), aw_mutex_unlock(&amutex), LONG_HOLD)
+BENCH_MUTEX(bench_pt_short, pthread_mutex_lock(&pmutex), pthread_mutex_unlock(&pmutex), 1)
+BENCH_MUTEX(bench_pt_long,  pthread_mutex_lock(&pmutex), pthread_mutex_unlock(&pmutex), LONG_HOLD)
+
+typedef struct {
+    const char* op;
+    aw_bench_fn fn;
+    int         long_hold;
+} bench_op_t;
+
+static const bench_op_t ops[] = {
+    { "aw_mutex_short",      bench_aw_short, 0 },
+    { "pthread_mutex_short", bench_pt_short, 0 },
+    { "aw_mutex_long",       bench_aw_long,  1 },
+    { "pthread_mutex_long",  bench_pt_long,  1 },
+};
+
+int main(int argc, char** argv) {
+    aw_bench_opts_t opts;
+    size_t k;
+    int threads;
+
+    aw_bench_parse(&opts, argc, argv, 200000);
+    aw_bench_begin(&opts);
+    for (k = 0; k < sizeof(ops) / sizeof(ops[0]); k++) {
+        for (threads = 1; threads; threads = aw_bench_next_threads(&opts, threads)) {
+            // 长临界区每次迭代的代价约为短临界区的 LONG_HOLD 倍，迭代次数相应缩减
+            long iters = ops[k].long_hold ? (opts.iters + 9) / 10 : opts.iters;
+            unsigned long long ns = aw_bench_run(threads, ops[k].fn, NULL, iters);
+
+            aw_bench_row(&opts, "mutex", ops[k].op, "acq_rel", 0, threads,
+                         threads == 1 ? "single" : "shared", iters, ns);
+        }
+    }
+    aw_bench_end(&opts);
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include "aw_bench.h"
+#include "aw_pool.h"
+
+/*
+ * aw_pool 与 malloc/free 的对比: 每个线程反复分配 BURST 个 64 字节对象再全部释放。
+ * BURST 大于一批，稳态下每轮都会经过一次补充与一次归还 (全局栈 CAS)。
+ * aw_pool_alloc+free_remote 以 aw_pool_free_remote 释放 (如释放别的线程分配的对象)，
+ * 测远程栈的压入以及补充时的整体取回。
+ */
+
+#define OBJ_SIZE 64
+#define BURST    48
+#define BLOCKS   (AW_TEST_MAX_THREADS * (BURST + 3 * AW_POOL_BATCH))
+
+static aw_pool_t pool;
+static union {
+    void*         align;
+    unsigned char bytes[BLOCKS * OBJ_SIZE];
+} slab;
+
+static void bench_pool(void* ctx, int id, long iters) {
+    aw_pool_cache_t cache;
+    void* held[BURST];
+    long n;
+    int i;
+
+    (void)ctx;
+    (void)id;
+    aw_pool_cache_init(&cache, &pool);
+    for (n = 0; n < iters; n += BURST) {
+        for (i = 0; i < BURST; i++) {
+            held[i] = aw_pool_alloc(&cache);
+            *(volatile unsigned char*)held[i] = (unsigned char)i;
+        }
+        for (i = 0; i < BURST; i++) {
+            aw_pool_free(&cache, held[i]);
+        }
+    }
+    aw_pool_cache_flush(&cache);
+}
+
+static void bench_pool_remote(void* ctx, int id, long iters) {
+    aw_pool_cache_t cache;
+    void* held[BURST];
+    long n;
+    int i;
+
+    (void)ctx;
+    (void)id;
+    aw_pool_cache_init(&cache, &pool);
+    for (n = 0; n < iters; n += BURST) {
+        for (i = 0; i < BURST; i++) {
+            held[i] = aw_pool_alloc(&cache);
+            *(volatile unsigned char*)held[i] = (unsigned char)i;
+        }
+        for (i = 0; i < BURST; i++) {
+            aw_pool_free_remote(&pool, held[i]);
+        }
+    }
+    aw_pool_cache_flush(&cache);
+}
+
+static void bench_malloc(void* ctx, int id, long iters) {
+    void* held[BURST];
+    long n;
+    int i;
+
+    (void)ctx;
+    (void)id;
+    for (n = 0; n < iters; n += BURST) {
+        for (i = 0; i < BURST; i++) {
+            held[i] = malloc(OBJ_SIZE);
+            *(volatile unsigned char*)held[i] = (unsigned char)i;
+        }
+        for (i = 0; i < BURST; i++) {
+            free(held[i]);
+        }
+    }
+}
+
+typedef struct {
+    const char* op;
+    aw_bench_fn fn;
+} bench_op_t;
+
+static const bench_op_t ops[] = {
+    { "aw_pool_alloc+free",        bench_pool },
+    { "aw_pool_alloc+free_remote", bench_pool_remote },
+    { "malloc+free",               bench_malloc },
+};
+
+int main(int argc, char** argv) {
+    aw_bench_opts_t opts;
+    size_t k;
+    int threads;
+    long iters;
+
+    aw_bench_parse(&opts, argc, argv, 1000000);
+    aw_pool_init(&pool, OBJ_SIZE);
+    AW_TEST_CHECK(aw_pool_add_slab(&pool, slab.bytes, sizeof(slab.bytes)) == BLOCKS);
+
+    // 迭代次数取 BURST 的整数倍，ns_per_op 为一次分配加一次释放
+    iters = (opts.iters + BURST - 1) / BURST * BURST;
+    aw_bench_begin(&opts);
+    for (k = 0; k < sizeof(ops) / sizeof(ops[0]); k++) {
+        for (threads = 1; threads; threads = aw_bench_next_threads(&opts, threads)) {
+            unsigned long long ns = aw_bench_run(threads, ops[k].fn, NULL, iters);
+
+            aw_bench_row(&opts, "pool", ops[k].op, "-", 0, threads,
+                         threads == 1 ? "single" : "private", iters, ns);
+        }
+    }
+    aw_bench_end(&opts);
+    return 0;
+}
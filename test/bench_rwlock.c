@@ -0,0 +1,152 @@
+#include "aw_bench.h"
+#include "aw_rwlock.h"
+#include "aw_mutex.h"
+
+/*
+ * 读多写少下的读写锁对比，读比例依次为 50% / 90% / 99% / 99.9%:
+ *   aw_rwlock       分布式读者槽位 (aw_rwlock.h)
+ *   word_rwlock     单字读写锁: 读者计数与写者标志在同一个字上，所有读者争同一条缓存行
+ *   pthread_rwlock
+ *   aw_mutex        读写都取同一把互斥锁
+ * 临界区读 (或写) DATA_WORDS 个共享字。每次迭代按线程编号与迭代序号的散列
+ * 决定读写，各线程的写入均匀分布而不是集中出现。
+ */
+
+#define DATA_WORDS 8
+
+static aw_rwlock_t      arw = AW_RWLOCK_INIT;
+static pthread_rwlock_t prw = PTHREAD_RWLOCK_INITIALIZER;
+static aw_mutex_t       amutex = AW_MUTEX_INIT;
+static aw_atomic_int_t  word_rw;    // -1: 写者持有，>= 0: 读者数
+
+static volatile unsigned long data[DATA_WORDS];
+static volatile unsigned long sink;
+
+// ============================================================================
+// 单字读写锁 (对照组)
+// ============================================================================
+
+static void word_read_lock(void) {
+    aw_backoff_t bo = AW_BACKOFF_INIT;
+    int v;
+
+    for (;;) {
+        v = aw_load_rlx(&word_rw);
+        if (v >= 0 && aw_cas_acq(&word_rw, &v, v + 1)) {
+            return;
+        }
+        aw_backoff_spin(&bo);
+    }
+}
+
+static void word_read_unlock(void) {
+    aw_fas_rel(&word_rw, 1);
+}
+
+static void word_write_lock(void) {
+    aw_backoff_t bo = AW_BACKOFF_INIT;
+    int v = 0;
+
+    while (!aw_cas_acq(&word_rw, &v, -1)) {
+        v = 0;
+        aw_backoff_spin(&bo);
+    }
+}
+
+static void word_write_unlock(void) {
+    aw_store_rel(&word_rw, 0);
+}
+
+// ============================================================================
+// 基准
+// ============================================================================
+
+static void read_data(void) {
+    unsigned long s = 0;
+    int i;
+
+    for (i = 0; i < DATA_WORDS; i++) {
+        s += data[i];
+    }
+    sink = s;
+}
+
+static void write_data(void) {
+    int i;
+
+    for (i = 0; i < DATA_WORDS; i++) {
+        data[i]++;
+    }
+}
+
+// 每 1000 次迭代中有 ctx 指向的次数为写
+#define BENCH_RWLOCK(name, rlock, runlock, wlock, wunlock) \
+    static void name(void* ctx, int id, long iters) { \
+        unsigned int writes = *(const unsigned int*)ctx; \
+        long i; \
+        for (i = 0; i < iters; i++) { \
+            unsigned int h = ((unsigned int)i * 2654435761u + (unsigned int)id * 40503u) % 1000u; \
+            if (h < writes) { \
+                wlock; \
+                write_data(); \
+                wunlock; \
+            } else { \
+                rlock; \
+                read_data(); \
+                runlock; \
+            } \
+        } \
+    }
+
+BENCH_RWLOCK(bench_aw_rwlock,
+             int slot = aw_rwlock_read_lock(&arw), aw_rwlock_read_unlock(&arw, slot),
+             aw_rwlock_write_lock(&arw), aw_rwlock_write_unlock(&arw))
+BENCH_RWLOCK(bench_word_rwlock,
+             word_read_lock(), word_read_unlock(),
+             word_write_lock(), word_write_unlock())
+BENCH_RWLOCK(bench_pthread_rwlock,
+             pthread_rwlock_rdlock(&prw), pthread_rwlock_unlock(&prw),
+             pthread_rwlock_wrlock(&prw), pthread_rwlock_unlock(&prw))
+BENCH_RWLOCK(bench_aw_mutex,
+             aw_mutex_lock(&amutex), aw_mutex_unlock(&amutex),
+             aw_mutex_lock(&amutex), aw_mutex_unlock(&amutex))
+
+typedef struct {
+    const char* op;
+    aw_bench_fn fn;
+} bench_op_t;
+
+static const bench_op_t ops[] = {
+    { "aw_rwlock",      bench_aw_rwlock },
+    { "word_rwlock",    bench_word_rwlock },
+    { "pthread_rwlock", bench_pthread_rwlock },
+    { "aw_mutex",       bench_aw_mutex },
+};
+
+// 每 1000 次中的写次数，与名称一一对应
+static const unsigned int writes[] = { 500, 100, 10, 1 };
+static const char* const  mixes[]  = { "read50", "read90", "read99", "read99.9" };
+
+int main(int argc, char** argv) {
+    aw_bench_opts_t opts;
+    size_t k, m;
+    int threads;
+
+    aw_bench_parse(&opts, argc, argv, 200000);
+    aw_bench_begin(&opts);
+    for (m = 0; m < sizeof(writes) / sizeof(writes[0]); m++) {
+        for (k = 0; k < sizeof(ops) / sizeof(ops[0]); k++) {
+            for (threads = 1; threads; threads = aw_bench_next_threads(&opts, threads)) {
+                char op[64];
+                unsigned int w = writes[m];
+                unsigned long long ns = aw_bench_run(threads, ops[k].fn, &w, opts.iters);
+
+                snprintf(op, sizeof(op), "%s_%s", ops[k].op, mixes[m]);
+                aw_bench_row(&opts, "rwlock", op, "acq_rel", 0, threads,
+                             threads == 1 ? "single" : "shared", opts.iters, ns);
+            }
+        }
+    }
+    aw_bench_end(&opts);
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include "aw_bench.h"
+#include "aw_sharded_counter.h"
+
+/*
+ * N 个线程同时递增同一个计数器:
+ *   aw_sharded_inc_rlx   aw_sharded_counter_t，每个线程写自己的分片 (记为 padded)
+ *   aw_inc_rlx           单个 aw_atomic_ullong_t，所有线程争同一条缓存行 (记为 shared)
+ * 每轮结束后校验总数，读取路径 (遍历所有分片) 单独一行。
+ */
+
+static aw_sharded_counter_t sharded;
+static aw_atomic_ullong_t   plain;
+
+static volatile unsigned long long sink;
+
+static void bench_sharded_inc(void* ctx, int id, long iters) {
+    long i;
+
+    (void)ctx;
+    (void)id;
+    for (i = 0; i < iters; i++) {
+        aw_sharded_inc_rlx(&sharded);
+    }
+}
+
+static void bench_plain_inc(void* ctx, int id, long iters) {
+    long i;
+
+    (void)ctx;
+    (void)id;
+    for (i = 0; i < iters; i++) {
+        aw_inc_rlx(&plain);
+    }
+}
+
+static void bench_sharded_load(void* ctx, int id, long iters) {
+    unsigned long long s = 0;
+    long i;
+
+    (void)ctx;
+    (void)id;
+    for (i = 0; i < iters; i++) {
+        s += aw_sharded_load_rlx(&sharded);
+    }
+    sink = s;
+}
+
+int main(int argc, char** argv) {
+    aw_bench_opts_t opts;
+    int threads;
+
+    aw_bench_parse(&opts, argc, argv, 1000000);
+    aw_bench_begin(&opts);
+    for (threads = 1; threads; threads = aw_bench_next_threads(&opts, threads)) {
+        unsigned long long total = (unsigned long long)threads * (unsigned long long)opts.iters;
+        unsigned long long ns;
+
+        aw_sharded_reset(&sharded);
+        ns = aw_bench_run(threads, bench_sharded_inc, NULL, opts.iters);
+        AW_TEST_CHECK(aw_sharded_load_rlx(&sharded) == total);
+        aw_bench_row(&opts, "sharded_counter", "aw_sharded_inc_rlx", "relaxed", 64, threads,
+                     threads == 1 ? "single" : "padded", opts.iters, ns);
+
+        aw_store_rlx(&plain, 0ull);
+        ns = aw_bench_run(threads, bench_plain_inc, NULL, opts.iters);
+        AW_TEST_CHECK(aw_load_rlx(&plain) == total);
+        aw_bench_row(&opts, "sharded_counter", "aw_inc_rlx", "relaxed", 64, threads,
+                     threads == 1 ? "single" : "shared", opts.iters, ns);
+    }
+    // 读取不与写入并发，单线程测一次即可
+    aw_bench_row(&opts, "sharded_counter", "aw_sharded_load_rlx", "relaxed", 64, 1, "single",
+                 opts.iters, aw_bench_run(1, bench_sharded_load, NULL, opts.iters));
+    aw_bench_end(&opts);
+    return 0;
+}
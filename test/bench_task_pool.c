@@ -0,0 +1,170 @@
+#include "aw_bench.h"
+#include "aw_task_pool.h"
+
+/*
+ * aw_task_pool 在 1..N 个工作者下的 fork/join 开销:
+ *   fib(FIB_N)      每个调用派生一个子任务 (最细粒度，主要测 spawn/take/steal)
+ *   parallel_for    对 PFOR_N 个元素二分派生，叶子为 PFOR_GRAIN 个元素的求和
+ * 一次操作 = 完成一次完整的 fib / parallel_for，由全部工作者协作完成:
+ * ns_per_op 为一次操作的耗时，ops_per_sec 为每秒完成的次数。
+ * -n 为总工作量 (fib 调用次数 / 元素个数)，据此换算重复次数。
+ */
+
+#define FIB_N      20
+#define FIB_CALLS  21891L       // fib(20) 的递归调用次数
+#define PFOR_N     (1L << 20)
+#define PFOR_GRAIN 1024L
+
+static aw_task_pool_t   pool;
+static aw_task_worker_t workers[AW_TEST_MAX_THREADS];
+static unsigned int     data[PFOR_N];
+
+// ============================================================================
+// fib
+// ============================================================================
+
+typedef struct {
+    aw_task_t         task;
+    int               n;
+    long              result;
+    aw_atomic_long_t* pending;
+} fib_t;
+
+static long fib(aw_task_worker_t* w, int n);
+
+static void fib_run(aw_task_t* t, aw_task_worker_t* w) {
+    fib_t* f = AW_CONTAINER_OF(t, fib_t, task);
+
+    f->result = fib(w, f->n);
+    aw_dec_ar(f->pending);
+}
+
+// 派生 fib(n - 1)，本线程计算 fib(n - 2)，再等待子任务
+static long fib(aw_task_worker_t* w, int n) {
+    aw_atomic_long_t pending;
+    fib_t child;
+    long b;
+
+    if (n < 2) {
+        return n;
+    }
+    aw_store_rlx(&pending, 1L);
+    child.task.run = fib_run;
+    child.n        = n - 1;
+    child.pending  = &pending;
+    aw_task_spawn(w, &child.task);
+    b = fib(w, n - 2);
+    aw_task_join(w, &pending);
+    return child.result + b;
+}
+
+// ============================================================================
+// parallel_for
+// ============================================================================
+
+typedef struct {
+    aw_task_t         task;
+    long              lo;
+    long              hi;
+    unsigned long     result;
+    aw_atomic_long_t* pending;
+} range_t;
+
+static unsigned long pfor(aw_task_worker_t* w, long lo, long hi);
+
+static void range_run(aw_task_t* t, aw_task_worker_t* w) {
+    range_t* r = AW_CONTAINER_OF(t, range_t, task);
+
+    r->result = pfor(w, r->lo, r->hi);
+    aw_dec_ar(r->pending);
+}
+
+static unsigned long pfor(aw_task_worker_t* w, long lo, long hi) {
+    aw_atomic_long_t pending;
+    range_t right;
+    unsigned long sum = 0;
+    long mid, i;
+
+    if (hi - lo <= PFOR_GRAIN) {
+        for (i = lo; i < hi; i++) {
+            sum += data[i];
+        }
+        return sum;
+    }
+    mid = lo + (hi - lo) / 2;
+    aw_store_rlx(&pending, 1L);
+    right.task.run = range_run;
+    right.lo       = mid;
+    right.hi       = hi;
+    right.pending  = &pending;
+    aw_task_spawn(w, &right.task);
+    sum = pfor(w, lo, mid);
+    aw_task_join(w, &pending);
+    return sum + right.result;
+}
+
+// ============================================================================
+// 驱动
+// ============================================================================
+
+typedef struct {
+    aw_task_t task;
+    int       kind;             // 0: fib, 1: parallel_for
+    long      runs;
+} driver_t;
+
+// 在工作者中重复 runs 次，完成后通知全部工作者退出
+static void driver_run(aw_task_t* t, aw_task_worker_t* w) {
+    driver_t* d = AW_CONTAINER_OF(t, driver_t, task);
+    long i;
+
+    for (i = 0; i < d->runs; i++) {
+        if (d->kind == 0) {
+            AW_TEST_CHECK(fib(w, FIB_N) == 6765);
+        } else {
+            AW_TEST_CHECK(pfor(w, 0, PFOR_N) == (unsigned long)PFOR_N * 3);
+        }
+    }
+    aw_task_pool_stop(&pool);
+}
+
+static void bench_thread(void* ctx, int id, long iters) {
+    (void)iters;
+    if (id == 0) {
+        aw_task_submit(&pool, &((driver_t*)ctx)->task);
+    }
+    aw_task_worker_run(&workers[id]);
+}
+
+int main(int argc, char** argv) {
+    static const char* names[2] = { "fib(20)", "parallel_for(2^20/1024)" };
+    aw_bench_opts_t opts;
+    int kind, threads;
+    long i;
+
+    for (i = 0; i < PFOR_N; i++) {
+        data[i] = 3;
+    }
+    aw_bench_parse(&opts, argc, argv, 4000000);
+    aw_bench_begin(&opts);
+    for (kind = 0; kind < 2; kind++) {
+        long per_run = kind == 0 ? FIB_CALLS : PFOR_N;
+
+        for (threads = 1; threads; threads = aw_bench_next_threads(&opts, threads)) {
+            driver_t d;
+            unsigned long long ns;
+
+            d.task.run = driver_run;
+            d.kind     = kind;
+            d.runs     = opts.iters / per_run > 0 ? opts.iters / per_run : 1;
+            AW_TEST_CHECK(aw_task_pool_init(&pool, workers, (unsigned int)threads, 8));
+            ns = aw_bench_run(threads, bench_thread, &d, d.runs);
+            aw_task_pool_destroy(&pool);
+            aw_bench_emit(&opts, "task_pool", names[kind], "-", 0, threads,
+                          threads == 1 ? "single" : "private", d.runs,
+                          (double)ns / (double)d.runs, (double)d.runs * 1e9 / (double)ns);
+        }
+    }
+    aw_bench_end(&opts);
+    return 0;
+}
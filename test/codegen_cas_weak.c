@@ -0,0 +1,13 @@
+#include "aw_atomic.h"
+
+/*
+ * make codegen CODEGEN_CC=<交叉编译器> 的检查对象: 只编译成汇编，不链接。
+ * 在没有 LSE 的 AArch64 上 aw_cas_weak 应为一对 ldaxr / stlxr，且没有回跳
+ * (强 CAS 会在 stlxr 失败时跳回 ldaxr 重试)。
+ */
+
+bool codegen_cas_weak(aw_atomic_ullong_t* p, unsigned long long* expected, unsigned long long desired);
+
+bool codegen_cas_weak(aw_atomic_ullong_t* p, unsigned long long* expected, unsigned long long desired) {
+    return aw_cas_weak(p, expected, desired, AW_MO_ACQ_REL, AW_MO_RELAXED);
+}
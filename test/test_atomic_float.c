@@ -0,0 +1,84 @@
+#include <math.h>
+
+#include "aw_test.h"
+#include "aw_atomic_float.h"
+
+#define THREADS 4
+#define ITERS   100000
+
+static aw_atomic_double_t sum64;
+static aw_atomic_float_t  sum32;
+
+// 0.5 与 1.0 可精确表示，总和在尾数范围内，结果与加法顺序无关
+static void* worker(void* arg) {
+    int i;
+
+    (void)arg;
+    for (i = 0; i < ITERS; i++) {
+        aw_fetch_add_f64(&sum64, 0.5, AW_MO_RELAXED);
+        aw_fetch_add_f32(&sum32, 1.0f, AW_MO_RELAXED);
+    }
+    return NULL;
+}
+
+int main(void) {
+    aw_atomic_double_t d;
+    aw_atomic_float_t  f;
+    double exp64;
+    float  exp32;
+
+    // 基本读写
+    aw_atomic_double_init(&d, 1.25);
+    AW_TEST_CHECK(aw_load_f64(&d, AW_MO_ACQUIRE) == 1.25);
+    AW_TEST_CHECK(aw_exchange_f64(&d, -3.0, AW_MO_ACQ_REL) == 1.25);
+    AW_TEST_CHECK(aw_fetch_add_f64(&d, 0.5, AW_MO_ACQ_REL) == -3.0);
+    AW_TEST_CHECK(aw_load_f64(&d, AW_MO_RELAXED) == -2.5);
+
+    aw_atomic_float_init(&f, 2.0f);
+    AW_TEST_CHECK(aw_exchange_f32(&f, 4.0f, AW_MO_ACQ_REL) == 2.0f);
+    AW_TEST_CHECK(aw_fetch_add_f32(&f, -1.0f, AW_MO_ACQ_REL) == 4.0f);
+    AW_TEST_CHECK(aw_load_f32(&f, AW_MO_RELAXED) == 3.0f);
+
+    // -0.0 与 +0.0 按位比较不相等，失败时写回的是带符号的当前值
+    aw_store_f64(&d, -0.0, AW_MO_RELAXED);
+    exp64 = 0.0;
+    AW_TEST_CHECK(!aw_cas_f64(&d, &exp64, 1.0, AW_MO_ACQ_REL, AW_MO_ACQUIRE));
+    AW_TEST_CHECK(exp64 == 0.0 && signbit(exp64));
+    AW_TEST_CHECK(aw_cas_f64(&d, &exp64, 1.0, AW_MO_ACQ_REL, AW_MO_ACQUIRE));
+
+    aw_store_f32(&f, 0.0f, AW_MO_RELAXED);
+    exp32 = -0.0f;
+    AW_TEST_CHECK(!aw_cas_f32(&f, &exp32, 1.0f, AW_MO_ACQ_REL, AW_MO_ACQUIRE));
+    AW_TEST_CHECK(exp32 == 0.0f && !signbit(exp32));
+
+    // NaN != NaN，但相同位模式的 NaN 按位相等，CAS 可以成功
+    aw_store_f64(&d, NAN, AW_MO_RELAXED);
+    exp64 = aw_load_f64(&d, AW_MO_RELAXED);
+    AW_TEST_CHECK(aw_cas_f64(&d, &exp64, 2.0, AW_MO_ACQ_REL, AW_MO_ACQUIRE));
+    AW_TEST_CHECK(aw_load_f64(&d, AW_MO_RELAXED) == 2.0);
+
+    aw_store_f32(&f, NAN, AW_MO_RELAXED);
+    exp32 = aw_load_f32(&f, AW_MO_RELAXED);
+    AW_TEST_CHECK(aw_cas_f32(&f, &exp32, 2.0f, AW_MO_ACQ_REL, AW_MO_ACQUIRE));
+
+    // 值为 NaN 时累加循环照常结束 (按位比较而不是浮点比较)，结果仍为 NaN
+    aw_store_f64(&d, NAN, AW_MO_RELAXED);
+    AW_TEST_CHECK(isnan(aw_fetch_add_f64(&d, 1.0, AW_MO_RELAXED)));
+    AW_TEST_CHECK(isnan(aw_load_f64(&d, AW_MO_RELAXED)));
+    aw_store_f32(&f, NAN, AW_MO_RELAXED);
+    AW_TEST_CHECK(isnan(aw_fetch_add_f32(&f, 1.0f, AW_MO_RELAXED)));
+
+    // -0.0 + +0.0 = +0.0: 位模式变化，CAS 照常提交
+    aw_store_f64(&d, -0.0, AW_MO_RELAXED);
+    AW_TEST_CHECK(signbit(aw_fetch_add_f64(&d, 0.0, AW_MO_RELAXED)));
+    AW_TEST_CHECK(!signbit(aw_load_f64(&d, AW_MO_RELAXED)));
+
+    // 并发累加
+    aw_atomic_double_init(&sum64, 0.0);
+    aw_atomic_float_init(&sum32, 0.0f);
+    aw_test_run_threads(THREADS, worker);
+    AW_TEST_CHECK(aw_load_f64(&sum64, AW_MO_ACQUIRE) == 0.5 * THREADS * ITERS);
+    AW_TEST_CHECK(aw_load_f32(&sum32, AW_MO_ACQUIRE) == (float)(THREADS * ITERS));
+
+    AW_TEST_PASS("atomic_float");
+}
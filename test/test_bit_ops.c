@@ -0,0 +1,86 @@
+#include "aw_test.h"
+#include "aw_atomic.h"
+
+#define THREADS 4
+
+static aw_atomic_int_t    word_i;
+static aw_atomic_uint_t   word_u;
+static aw_atomic_long_t   word_l;
+static aw_atomic_ullong_t word_ull;
+static int                evals;
+
+static aw_atomic_int_t* get_word(void) {
+    evals++;
+    return &word_i;
+}
+
+static unsigned int get_bit(unsigned int bit) {
+    evals++;
+    return bit;
+}
+
+// 每个线程翻转自己的 8 个位各两次，最终应回到 0，且每次翻转都看到正确的旧值
+static aw_atomic_ullong_t shared;
+static aw_atomic_int_t    wrong;
+
+static void* worker(void* arg) {
+    int id = (int)(intptr_t)arg;
+    int i, round;
+
+    for (round = 0; round < 1000; round++) {
+        for (i = 0; i < 8; i++) {
+            unsigned int bit = (unsigned int)(id * 8 + i + 32);
+            if (aw_bit_test_and_set(&shared, bit, AW_MO_ACQ_REL) ||
+                !aw_bit_test_and_complement(&shared, bit, AW_MO_ACQ_REL) ||
+                aw_bit_test_and_reset(&shared, bit, AW_MO_ACQ_REL)) {
+                aw_fetch_add(&wrong, 1, AW_MO_RELAXED);
+            }
+        }
+    }
+    return NULL;
+}
+
+int main(void) {
+    // ptr 与 bit 各只求值一次
+    AW_TEST_CHECK(!aw_bit_test_and_set(get_word(), get_bit(31), AW_MO_SEQ_CST));
+    AW_TEST_CHECK(evals == 2);
+
+    // 符号位
+    AW_TEST_CHECK(aw_bit_test_and_set(&word_i, 31, AW_MO_SEQ_CST));
+    AW_TEST_CHECK(aw_load(&word_i, AW_MO_RELAXED) == (int)0x80000000u);
+    AW_TEST_CHECK(aw_bit_test_and_reset(&word_i, 31, AW_MO_SEQ_CST));
+    AW_TEST_CHECK(aw_load(&word_i, AW_MO_RELAXED) == 0);
+
+    AW_TEST_CHECK(!aw_bit_test_and_complement(&word_u, 31, AW_MO_RELAXED));
+    AW_TEST_CHECK(aw_load(&word_u, AW_MO_RELAXED) == 0x80000000u);
+    AW_TEST_CHECK(aw_bit_test_and_complement(&word_u, 31, AW_MO_RELAXED));
+    AW_TEST_CHECK(aw_load(&word_u, AW_MO_RELAXED) == 0);
+
+    // 64 位字的高位
+    AW_TEST_CHECK(!aw_bit_test_and_set(&word_ull, 63, AW_MO_ACQ_REL));
+    AW_TEST_CHECK(aw_load(&word_ull, AW_MO_RELAXED) == 1ULL << 63);
+    AW_TEST_CHECK(!aw_bit_test_and_set(&word_ull, 0, AW_MO_ACQ_REL));
+    AW_TEST_CHECK(aw_bit_test_and_reset(&word_ull, 63, AW_MO_ACQ_REL));
+    AW_TEST_CHECK(aw_load(&word_ull, AW_MO_RELAXED) == 1);
+
+    // 清除不相干的位不影响其它位
+    aw_store(&word_l, 0x5L, AW_MO_RELAXED);
+    AW_TEST_CHECK(!aw_bit_test_and_reset(&word_l, 1, AW_MO_RELAXED));
+    AW_TEST_CHECK(aw_load(&word_l, AW_MO_RELAXED) == 0x5L);
+    AW_TEST_CHECK(aw_bit_test_and_reset(&word_l, 2, AW_MO_RELAXED));
+    AW_TEST_CHECK(aw_load(&word_l, AW_MO_RELAXED) == 0x1L);
+
+    // aw_fetch_max / aw_fetch_min 返回旧值，且只在需要时修改
+    aw_store(&word_i, -5, AW_MO_RELAXED);
+    AW_TEST_CHECK(aw_fetch_max(&word_i, 3, AW_MO_ACQ_REL) == -5);
+    AW_TEST_CHECK(aw_fetch_max(&word_i, 1, AW_MO_ACQ_REL) == 3);
+    AW_TEST_CHECK(aw_fetch_min(&word_i, -7, AW_MO_ACQ_REL) == 3);
+    AW_TEST_CHECK(aw_load(&word_i, AW_MO_RELAXED) == -7);
+
+    aw_store(&word_ull, 0, AW_MO_RELAXED);
+    aw_test_run_threads(THREADS, worker);
+    AW_TEST_CHECK(aw_load(&wrong, AW_MO_RELAXED) == 0);
+    AW_TEST_CHECK(aw_load(&shared, AW_MO_RELAXED) == 0);
+
+    AW_TEST_PASS("bit_ops");
+}
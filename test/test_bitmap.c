@@ -0,0 +1,93 @@
+#include "aw_test.h"
+#include "aw_bitmap.h"
+
+#define THREADS 4
+#define NBITS   1000            // 不是 64 的整数倍，末尾的字只有部分有效位
+#define HELD    200             // 每个线程同时持有的 ID 数，4 个线程合计 800
+
+#define BIG_WORDS 200         // 摘要跨 4 个字
+static unsigned long long mem[AW_BITMAP_MEM_SIZE(NBITS) / 8];
+static aw_bitmap_t        ids;
+static unsigned long long big_mem[AW_BITMAP_MEM_SIZE(BIG_WORDS * 64) / 8];
+static aw_bitmap_t        big;
+static aw_atomic_int_t    owner[NBITS];     // 0: 空闲，否则为持有者编号 + 1
+
+static void* worker(void* arg) {
+    int id = (int)(intptr_t)arg;
+    long held[HELD];
+    int i, round, expected;
+
+    for (round = 0; round < aw_test_iters(200, 50); round++) {
+        for (i = 0; i < HELD; i++) {
+            held[i] = aw_bitmap_alloc(&ids);
+            AW_TEST_CHECK(held[i] >= 0 && held[i] < NBITS);
+            // 同一个 ID 不会同时分配给两个线程
+            expected = 0;
+            AW_TEST_CHECK(aw_cas_ar(&owner[held[i]], &expected, id + 1));
+        }
+        for (i = 0; i < HELD; i++) {
+            aw_store_rel(&owner[held[i]], 0);
+            aw_bitmap_free(&ids, held[i]);
+        }
+    }
+    return NULL;
+}
+
+int main(void) {
+    static unsigned char seen[NBITS];
+    long id, run;
+    int n, k;
+
+    AW_TEST_CHECK(aw_bitmap_init(&ids, mem, NBITS));
+
+    // 单线程: 恰好分配出 NBITS 个互不相同的 ID
+    for (n = 0; (id = aw_bitmap_alloc(&ids)) >= 0; n++) {
+        AW_TEST_CHECK(id < NBITS && !seen[id]);
+        AW_TEST_CHECK(aw_bitmap_test(&ids, id));
+        seen[id] = 1;
+    }
+    AW_TEST_CHECK(n == NBITS);
+
+    // 已满的字被摘要跳过，释放后仍能重新分配到
+    aw_bitmap_free(&ids, 130);
+    AW_TEST_CHECK(!aw_bitmap_test(&ids, 130));
+    AW_TEST_CHECK(aw_bitmap_alloc(&ids) == 130);
+    AW_TEST_CHECK(aw_bitmap_alloc(&ids) == -1);
+    for (id = 0; id < NBITS; id++) {
+        aw_bitmap_free(&ids, id);
+    }
+
+    // 连续分配: n 个 ID 位于同一个字内且全部置位
+    run = aw_bitmap_alloc_n(&ids, 8);
+    AW_TEST_CHECK(run >= 0 && run / 64 == (run + 7) / 64);
+    for (k = 0; k < 8; k++) {
+        AW_TEST_CHECK(aw_bitmap_test(&ids, run + k));
+    }
+    AW_TEST_CHECK(aw_bitmap_alloc_n(&ids, 0) == -1 && aw_bitmap_alloc_n(&ids, 65) == -1);
+    aw_bitmap_free_n(&ids, run, 8);
+    AW_TEST_CHECK(aw_bitmap_alloc_n(&ids, 64) % 64 == 0);
+    AW_TEST_CHECK(aw_bitmap_init(&ids, mem, NBITS));
+
+    // 摘要跳过: 全满后零散释放几个 (不在摘要字边界上的) 字中的位，都能找到
+    AW_TEST_CHECK(aw_bitmap_init(&big, big_mem, BIG_WORDS * 64));
+    for (n = 0; n < BIG_WORDS; n++) {
+        AW_TEST_CHECK(aw_bitmap_alloc_n(&big, 64) >= 0);
+    }
+    AW_TEST_CHECK(aw_bitmap_alloc(&big) == -1);
+    aw_bitmap_free(&big, 3 * 64 + 9);
+    aw_bitmap_free(&big, 77 * 64 + 5);
+    aw_bitmap_free(&big, 150 * 64 + 63);
+    for (n = 0; (id = aw_bitmap_alloc(&big)) >= 0; n++) {
+        AW_TEST_CHECK(id == 3 * 64 + 9 || id == 77 * 64 + 5 || id == 150 * 64 + 63);
+    }
+    AW_TEST_CHECK(n == 3);
+
+    aw_test_run_threads(THREADS, worker);
+
+    // 全部释放后容量不变
+    for (n = 0; aw_bitmap_alloc(&ids) >= 0; n++) {
+    }
+    AW_TEST_CHECK(n == NBITS);
+
+    AW_TEST_PASS("bitmap");
+}
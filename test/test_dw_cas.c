@@ -0,0 +1,57 @@
+#include "aw_test.h"
+#include "aw_atomic.h"
+
+#define THREADS 4
+#define ITERS   50000
+
+#ifdef AW_HAS_DW_CAS
+
+static aw_atomic_dw_t word;
+
+// 两半同时更新: 任何撕裂的读取或丢失的 CAS 都会让 hi != 2 * lo
+static void* worker(void* arg) {
+    int i;
+
+    (void)arg;
+    for (i = 0; i < ITERS; i++) {
+        aw_dw_t exp = aw_load_dw(&word, AW_MO_RELAXED);
+        aw_dw_t des;
+        do {
+            AW_TEST_CHECK(exp.hi == 2 * exp.lo);
+            des.lo = exp.lo + 1;
+            des.hi = exp.hi + 2;
+        } while (!aw_cas_dw(&word, &exp, des, AW_MO_ACQ_REL, AW_MO_RELAXED));
+    }
+    return NULL;
+}
+
+int main(void) {
+    aw_dw_t exp, des, v;
+
+    AW_TEST_CHECK(sizeof(aw_dw_t) == AW_DW_SIZE);
+    AW_TEST_CHECK(((uintptr_t)&word % AW_DW_SIZE) == 0);
+
+    // 失败的 CAS 把当前值写回 expected
+    exp.lo = 1;
+    exp.hi = 1;
+    des.lo = 5;
+    des.hi = 5;
+    AW_TEST_CHECK(!aw_cas_dw(&word, &exp, des, AW_MO_SEQ_CST, AW_MO_RELAXED));
+    AW_TEST_CHECK(exp.lo == 0 && exp.hi == 0);
+
+    aw_test_run_threads(THREADS, worker);
+    v = aw_load_dw(&word, AW_MO_ACQUIRE);
+    AW_TEST_CHECK(v.lo == (uintptr_t)THREADS * ITERS);
+    AW_TEST_CHECK(v.hi == (uintptr_t)THREADS * ITERS * 2);
+
+    AW_TEST_PASS("dw_cas");
+}
+
+#else
+
+int main(void) {
+    // __sync 通用回退后端不提供双字 CAS
+    AW_TEST_PASS("dw_cas (not available on this backend)");
+}
+
+#endif
@@ -0,0 +1,137 @@
+#include "aw_test.h"
+#include "aw_epoch.h"
+
+#define WRITERS 2
+#define READERS 2
+#define PER_WRITER 50000
+
+#define OBJ_LIVE 1
+#define OBJ_DEAD 2
+
+// 回收时只做标记 (见 test_hazard.c)
+typedef struct {
+    aw_epoch_node_t ep;
+    aw_atomic_int_t state;
+} obj_t;
+
+static obj_t             objs[WRITERS * PER_WRITER + 1];
+static aw_atomic_int_t   next_obj;
+static aw_epoch_domain_t dom;
+static aw_atomic_ptr_t   shared;
+static aw_atomic_int_t   writers_done;
+static aw_atomic_long_t  reclaimed;
+
+static obj_t* obj_new(void) {
+    obj_t* o = &objs[aw_faa_rlx(&next_obj, 1)];
+    aw_store_rlx(&o->state, OBJ_LIVE);
+    return o;
+}
+
+static void obj_reclaim(void* p) {
+    obj_t* o = (obj_t*)p;
+    AW_TEST_CHECK(aw_swap_rlx(&o->state, OBJ_DEAD) == OBJ_LIVE);
+    aw_inc_rlx(&reclaimed);
+}
+
+static void* writer(void) {
+    aw_epoch_rec_t* rec = aw_epoch_acquire(&dom);
+    int i;
+
+    AW_TEST_CHECK(rec != NULL);
+    for (i = 0; i < PER_WRITER; i++) {
+        obj_t* old = (obj_t*)aw_swap_ar(&shared, (void*)obj_new());
+        if (old != NULL) {
+            aw_epoch_retire(&dom, rec, old, &old->ep, obj_reclaim);
+        }
+    }
+    aw_epoch_release(rec);
+    aw_inc_ar(&writers_done);
+    return NULL;
+}
+
+// 嵌套进入临界区，覆盖 nest 计数
+static void* reader(void) {
+    aw_epoch_rec_t* rec = aw_epoch_acquire(&dom);
+
+    AW_TEST_CHECK(rec != NULL);
+    while (aw_load_acq(&writers_done) < WRITERS) {
+        obj_t* o;
+
+        aw_epoch_enter(&dom, rec);
+        aw_epoch_enter(&dom, rec);
+        o = (obj_t*)aw_load_acq(&shared);
+        aw_epoch_exit(&dom, rec);
+        if (o != NULL) {
+            AW_TEST_CHECK(aw_load_rlx(&o->state) == OBJ_LIVE);
+        }
+        aw_epoch_exit(&dom, rec);
+    }
+    aw_epoch_release(rec);
+    return NULL;
+}
+
+static void* run(void* arg) {
+    return (intptr_t)arg < WRITERS ? writer() : reader();
+}
+
+// 单线程: 从 32 位回绕点之前开始推进纪元，活跃读者在场时不能推进，
+// 退休对象在纪元前进两次之后才被回收
+static void check_generations(void) {
+    aw_epoch_rec_t* rd = aw_epoch_acquire(&dom);
+    aw_epoch_rec_t* wr = aw_epoch_acquire(&dom);
+    obj_t* a = obj_new();
+    int step;
+
+    AW_TEST_CHECK(rd != NULL && wr != NULL);
+    aw_store_rlx(&dom.epoch, 0xFFFFFFFFull - 3);
+    wr->local_epoch = 0xFFFFFFFFull - 3;
+
+    aw_epoch_enter(&dom, rd);
+    aw_epoch_retire(&dom, wr, a, &a->ep, obj_reclaim);
+    AW_TEST_CHECK(aw_epoch_try_advance(&dom));      // 读者已公告当前纪元
+    AW_TEST_CHECK(!aw_epoch_try_advance(&dom));     // 读者仍停在旧纪元
+    aw_epoch_collect(&dom, wr);
+    AW_TEST_CHECK(aw_load_rlx(&a->state) == OBJ_LIVE);
+    aw_epoch_exit(&dom, rd);
+
+    AW_TEST_CHECK(aw_epoch_try_advance(&dom));
+    aw_epoch_collect(&dom, wr);
+    AW_TEST_CHECK(aw_load_rlx(&a->state) == OBJ_DEAD);
+    AW_TEST_CHECK(aw_load_rlx(&dom.epoch) > 0xFFFFFFFFull);
+
+    // 跨过旧的回绕点继续推进，每代对象都恰好在前进两次后回收
+    for (step = 0; step < 16; step++) {
+        obj_t* o = obj_new();
+        aw_epoch_retire(&dom, wr, o, &o->ep, obj_reclaim);
+        AW_TEST_CHECK(aw_epoch_try_advance(&dom));
+        aw_epoch_collect(&dom, wr);
+        AW_TEST_CHECK(aw_load_rlx(&o->state) == OBJ_LIVE);
+        AW_TEST_CHECK(aw_epoch_try_advance(&dom));
+        aw_epoch_collect(&dom, wr);
+        AW_TEST_CHECK(aw_load_rlx(&o->state) == OBJ_DEAD);
+    }
+    AW_TEST_CHECK(wr->limbo_count == 0);
+
+    aw_epoch_release(rd);
+    aw_epoch_release(wr);
+}
+
+int main(void) {
+    long made;
+
+    aw_epoch_domain_init(&dom, 0);
+    check_generations();
+
+    aw_epoch_domain_init(&dom, 0);
+    aw_store_rlx(&reclaimed, 0);
+    aw_store_rlx(&next_obj, 0);
+
+    aw_test_run_threads(WRITERS + READERS, run);
+
+    aw_epoch_domain_drain(&dom);
+    made = aw_load_rlx(&next_obj);
+    AW_TEST_CHECK(made == WRITERS * PER_WRITER);
+    AW_TEST_CHECK(aw_load_rlx(&reclaimed) == made - 1);
+
+    AW_TEST_PASS("epoch");
+}
@@ -0,0 +1,103 @@
+#include <sched.h>
+
+#include "aw_test.h"
+#include "aw_eventcount.h"
+
+#define CONSUMERS 3
+#define TOKENS    20000
+
+static aw_eventcount_t  ec = AW_EVENTCOUNT_INIT;
+static aw_atomic_int_t  tokens;         // 生产方递增，消费方以 CAS 取走
+static aw_atomic_int_t  consumed;
+static aw_atomic_int_t  stop;
+
+static bool try_take(void) {
+    int t = aw_load_rlx(&tokens);
+
+    while (t > 0) {
+        if (aw_cas_acq(&tokens, &t, t - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 取到一个令牌返回 true，stop 后返回 false
+static bool take(void) {
+    for (;;) {
+        unsigned int key;
+
+        if (try_take()) {
+            return true;
+        }
+        if (aw_load_acq(&stop)) {
+            return false;
+        }
+        key = aw_eventcount_prepare_wait(&ec);
+        if (aw_load_rlx(&tokens) > 0 || aw_load_acq(&stop)) {
+            aw_eventcount_cancel_wait(&ec);
+            continue;
+        }
+        aw_eventcount_commit_wait(&ec, key);
+    }
+}
+
+static void* consumer(void* arg) {
+    (void)arg;
+    while (take()) {
+        aw_inc_rlx(&consumed);
+    }
+    return NULL;
+}
+
+int main(void) {
+    pthread_t tid[CONSUMERS];
+    unsigned int key;
+    int i;
+
+    // 没有等待者时通知不改变 epoch
+    aw_eventcount_notify(&ec);
+    AW_TEST_CHECK(aw_load_rlx(&ec.epoch) == 0u);
+    aw_eventcount_notify_if_waiting(&ec);
+    AW_TEST_CHECK(aw_load_rlx(&ec.epoch) == 0u);
+
+    // prepare 之后到达的通知让 commit 立即返回 (不丢失唤醒)
+    key = aw_eventcount_prepare_wait(&ec);
+    aw_eventcount_notify(&ec);
+    AW_TEST_CHECK(aw_load_rlx(&ec.epoch) == key + 1u);
+    aw_eventcount_commit_wait(&ec, key);
+    AW_TEST_CHECK(aw_load_rlx(&ec.waiters) == 0u);
+
+    key = aw_eventcount_prepare_wait(&ec);
+    aw_eventcount_notify_if_waiting(&ec);
+    aw_eventcount_commit_wait(&ec, key);
+    AW_TEST_CHECK(aw_load_rlx(&ec.epoch) == key + 1u);
+
+    key = aw_eventcount_prepare_wait(&ec);
+    aw_eventcount_cancel_wait(&ec);
+    AW_TEST_CHECK(aw_load_rlx(&ec.waiters) == 0u);
+
+    // 生产方逐个发放令牌，消费方在没有令牌时挂起
+    for (i = 0; i < CONSUMERS; i++) {
+        AW_TEST_CHECK(pthread_create(&tid[i], NULL, consumer, NULL) == 0);
+    }
+    for (i = 0; i < TOKENS; i++) {
+        aw_faa_rel(&tokens, 1);
+        aw_eventcount_notify(&ec);
+        if (i % 256 == 0) {
+            sched_yield();
+        }
+    }
+    while (aw_load_acq(&consumed) != TOKENS) {
+        sched_yield();
+    }
+    aw_store_rel(&stop, 1);
+    aw_eventcount_notify_all(&ec);
+    for (i = 0; i < CONSUMERS; i++) {
+        AW_TEST_CHECK(pthread_join(tid[i], NULL) == 0);
+    }
+    AW_TEST_CHECK(aw_load_rlx(&tokens) == 0);
+    AW_TEST_CHECK(aw_load_rlx(&ec.waiters) == 0u);
+
+    AW_TEST_PASS("eventcount");
+}
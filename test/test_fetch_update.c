@@ -0,0 +1,53 @@
+#include "aw_test.h"
+#include "aw_atomic_simple.h"
+
+#define THREADS 4
+#define ITERS   50000
+#define LIMIT   (THREADS * ITERS / 2)
+
+static aw_atomic_ullong_t pair;         // 高低 32 位必须同步增长
+static aw_atomic_uint_t   saturating;   // 超过 LIMIT 后不再增长
+static aw_atomic_uint_t   weak_counter;
+
+static void* worker(void* arg) {
+    unsigned long long old64;
+    unsigned int old, exp;
+    int i;
+
+    (void)arg;
+    for (i = 0; i < ITERS; i++) {
+        aw_fetch_update(&pair, old64, old64 + (1ULL << 32) + 1, AW_MO_ACQ_REL);
+        AW_TEST_CHECK((old64 >> 32) == (old64 & 0xffffffffu));
+
+        aw_fetch_update(&saturating, old, old < LIMIT ? old + 1 : old, AW_MO_RELAXED);
+        AW_TEST_CHECK(old <= LIMIT);
+
+        // 手写的弱 CAS 循环: 失败 (含伪失败) 时 exp 被更新为当前值
+        exp = aw_load_rlx(&weak_counter);
+        while (!aw_cas_weak_rlx(&weak_counter, &exp, exp + 1)) {
+        }
+    }
+    return NULL;
+}
+
+int main(void) {
+    unsigned int old, exp;
+
+    // 单线程: 结束后 old_var 为更新前的值
+    aw_store_rlx(&saturating, 5u);
+    aw_fetch_update(&saturating, old, old * 3, AW_MO_SEQ_CST);
+    AW_TEST_CHECK(old == 5u && aw_load_rlx(&saturating) == 15u);
+
+    // 期望值不符时弱 CAS 必定失败，并写回当前值
+    exp = 1u;
+    AW_TEST_CHECK(!aw_cas_weak_ar(&saturating, &exp, 0u));
+    AW_TEST_CHECK(exp == 15u && aw_load_rlx(&saturating) == 15u);
+    aw_store_rlx(&saturating, 0u);
+
+    aw_test_run_threads(THREADS, worker);
+    AW_TEST_CHECK(aw_load_rlx(&pair) == ((unsigned long long)THREADS * ITERS << 32) + THREADS * ITERS);
+    AW_TEST_CHECK(aw_load_rlx(&saturating) == LIMIT);
+    AW_TEST_CHECK(aw_load_rlx(&weak_counter) == THREADS * ITERS);
+
+    AW_TEST_PASS("fetch_update");
+}
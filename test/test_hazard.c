@@ -0,0 +1,120 @@
+#include "aw_test.h"
+#include "aw_hazard.h"
+
+#define WRITERS 2
+#define READERS 2
+#define PER_WRITER 50000
+
+#define OBJ_LIVE 1
+#define OBJ_DEAD 2
+
+// 对象取自静态数组且回收时只做标记，读者读到 OBJ_DEAD 即说明过早回收，
+// 检测过程本身不会访问已释放的内存
+typedef struct {
+    aw_hazard_node_t hz;
+    aw_atomic_int_t  state;
+} obj_t;
+
+static obj_t              objs[WRITERS * PER_WRITER + 1];
+static aw_atomic_int_t    next_obj;
+static aw_hazard_domain_t dom;
+static aw_atomic_ptr_t    shared;
+static aw_atomic_int_t    writers_done;
+static aw_atomic_long_t   reclaimed;
+
+static obj_t* obj_new(void) {
+    obj_t* o = &objs[aw_faa_rlx(&next_obj, 1)];
+    aw_store_rlx(&o->state, OBJ_LIVE);
+    return o;
+}
+
+static void obj_reclaim(void* p) {
+    obj_t* o = (obj_t*)p;
+    AW_TEST_CHECK(aw_swap_rlx(&o->state, OBJ_DEAD) == OBJ_LIVE);
+    aw_inc_rlx(&reclaimed);
+}
+
+static void* writer(void) {
+    aw_hazard_rec_t* rec = aw_hazard_acquire(&dom);
+    int i;
+
+    AW_TEST_CHECK(rec != NULL);
+    for (i = 0; i < PER_WRITER; i++) {
+        obj_t* old = (obj_t*)aw_swap_ar(&shared, (void*)obj_new());
+        if (old != NULL) {
+            aw_hazard_retire(&dom, rec, old, &old->hz, obj_reclaim);
+            // 每次扫描后残留的退休节点不超过被保护的数量
+            AW_TEST_CHECK(rec->retired_count < dom.threshold);
+        }
+    }
+    aw_hazard_release(rec);
+    aw_inc_ar(&writers_done);
+    return NULL;
+}
+
+static void* reader(void) {
+    aw_hazard_rec_t* rec = aw_hazard_acquire(&dom);
+
+    AW_TEST_CHECK(rec != NULL);
+    while (aw_load_acq(&writers_done) < WRITERS) {
+        obj_t* o = (obj_t*)aw_hazard_protect(rec, 0, &shared);
+        if (o != NULL) {
+            AW_TEST_CHECK(aw_load_rlx(&o->state) == OBJ_LIVE);
+        }
+        aw_hazard_clear(rec, 0);
+    }
+    aw_hazard_release(rec);
+    return NULL;
+}
+
+static void* run(void* arg) {
+    return (intptr_t)arg < WRITERS ? writer() : reader();
+}
+
+// 单线程: 受保护的对象在扫描中保留，清除槽位后下一次扫描回收
+static void check_protect_blocks_reclaim(void) {
+    aw_hazard_rec_t* rd = aw_hazard_acquire(&dom);
+    aw_hazard_rec_t* wr = aw_hazard_acquire(&dom);
+    obj_t* a = obj_new();
+    obj_t* b = obj_new();
+
+    AW_TEST_CHECK(rd != NULL && wr != NULL && rd != wr);
+    aw_store_rel(&shared, (void*)a);
+    AW_TEST_CHECK(aw_hazard_protect(rd, 1, &shared) == a);
+    aw_store_rel(&shared, NULL);
+
+    aw_hazard_retire(&dom, wr, a, &a->hz, obj_reclaim);
+    aw_hazard_retire(&dom, wr, b, &b->hz, obj_reclaim);
+    aw_hazard_scan(&dom, wr);
+    AW_TEST_CHECK(aw_load_rlx(&a->state) == OBJ_LIVE);
+    AW_TEST_CHECK(aw_load_rlx(&b->state) == OBJ_DEAD);
+    AW_TEST_CHECK(wr->retired_count == 1);
+
+    aw_hazard_clear(rd, 1);
+    aw_hazard_scan(&dom, wr);
+    AW_TEST_CHECK(aw_load_rlx(&a->state) == OBJ_DEAD);
+    AW_TEST_CHECK(wr->retired_count == 0);
+
+    aw_hazard_release(rd);
+    aw_hazard_release(wr);
+}
+
+int main(void) {
+    long made;
+
+    aw_hazard_domain_init(&dom, 0);
+    check_protect_blocks_reclaim();
+    aw_store_rlx(&reclaimed, 0);
+    aw_store_rlx(&next_obj, 0);
+
+    aw_test_run_threads(WRITERS + READERS, run);
+
+    // 最后一个对象仍挂在 shared 上，其余全部退休，drain 后都已回收
+    aw_hazard_domain_drain(&dom);
+    made = aw_load_rlx(&next_obj);
+    AW_TEST_CHECK(made == WRITERS * PER_WRITER);
+    AW_TEST_CHECK(aw_load_rlx(&reclaimed) == made - 1);
+    AW_TEST_CHECK(aw_load_rlx(&((obj_t*)aw_load_rlx(&shared))->state) == OBJ_LIVE);
+
+    AW_TEST_PASS("hazard");
+}
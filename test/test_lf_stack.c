@@ -0,0 +1,139 @@
+#include "aw_test.h"
+#include "aw_lf_stack.h"
+
+#define THREADS 4
+#define ITERS   1000000
+#define NODES   16          // 节点很少，保证同一节点被反复弹出/压回 (ABA 场景)
+
+typedef struct {
+    aw_lf_node_t    link;
+    aw_atomic_int_t held;   // 1: 已被某个线程弹出持有
+} node_t;
+
+static node_t        nodes[NODES];
+static aw_lf_stack_t stack = AW_LF_STACK_INIT;
+
+// 弹出后标记持有，同一节点被两个线程同时弹出 (重复) 会在这里被发现
+static node_t* take(void) {
+    node_t* n = (node_t*)aw_lf_stack_pop(&stack);
+    if (n != NULL) {
+        AW_TEST_CHECK(n >= nodes && n < nodes + NODES);
+        AW_TEST_CHECK(aw_swap_acq(&n->held, 1) == 0);
+    }
+    return n;
+}
+
+static void give(node_t* n) {
+    aw_store_rel(&n->held, 0);
+    aw_lf_stack_push(&stack, &n->link);
+}
+
+// 每个线程手里最多持有 HAND 个节点，随机地弹出或按随机顺序压回。
+// 栈的形状因此不断变化: 某线程停在 pop 中 (已读到 A 和 A->next) 时，
+// 其他线程弹出 A、B 并只压回 A，栈顶又是 A 但 A->next 已不再是 B，
+// 没有标签保护时那次 CAS 会把仍被持有的 B 放回栈顶
+#define HAND 3
+
+static void* worker(void* arg) {
+    node_t* hand[HAND];
+    unsigned int rng = 2463534242u + (unsigned int)(intptr_t)arg * 7919u;
+    int held = 0;
+    int i;
+
+    for (i = 0; i < ITERS; i++) {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+
+        if (held < HAND && (held == 0 || (rng & 1) != 0)) {
+            node_t* n = take();
+            if (n != NULL) {
+                hand[held++] = n;
+            }
+        } else {
+            int k = (int)((rng >> 1) % (unsigned int)held);
+            give(hand[k]);
+            hand[k] = hand[--held];
+        }
+
+        // 偶尔整体取走再以链表压回，覆盖 pop_all 与 push_list
+        if (i % 1024 == 0) {
+            aw_lf_node_t* first = aw_lf_stack_pop_all(&stack);
+            aw_lf_node_t* last  = first;
+
+            if (first != NULL) {
+                while (aw_load_rlx(&last->next) != NULL) {
+                    last = (aw_lf_node_t*)aw_load_rlx(&last->next);
+                }
+                aw_lf_stack_push_list(&stack, first, last);
+            }
+        }
+    }
+    while (held > 0) {
+        give(hand[--held]);
+    }
+    return NULL;
+}
+
+// 单线程重放 ABA 交错: 按 aw_lf_stack_pop 的步骤读取栈顶 A 与 A->next (B)，
+// 随后 "其他线程" 弹出 A、B 并压回 A，被挂起的那次 CAS 必须失败
+static void check_aba_replay(void) {
+    aw_lf_stack_t s = AW_LF_STACK_INIT;
+    aw_lf_node_t  a, b, c;
+    unsigned long long old;
+    aw_lf_node_t* next;
+
+    aw_lf_stack_push(&s, &c);
+    aw_lf_stack_push(&s, &b);
+    aw_lf_stack_push(&s, &a);
+
+    old  = aw_load_acq(&s.head);
+    next = (aw_lf_node_t*)aw_load_rlx(&_aw_lf_ptr(old)->next);
+    AW_TEST_CHECK(_aw_lf_ptr(old) == &a && next == &b);
+
+    AW_TEST_CHECK(aw_lf_stack_pop(&s) == &a);
+    AW_TEST_CHECK(aw_lf_stack_pop(&s) == &b);
+    aw_lf_stack_push(&s, &a);
+    AW_TEST_CHECK(_aw_lf_ptr(aw_load_rlx(&s.head)) == &a);
+
+    AW_TEST_CHECK(!aw_cas(&s.head, &old, _aw_lf_pack(old, next), AW_MO_ACQUIRE, AW_MO_ACQUIRE));
+    AW_TEST_CHECK(aw_lf_stack_pop(&s) == &a);
+    AW_TEST_CHECK(aw_lf_stack_pop(&s) == &c);
+    AW_TEST_CHECK(aw_lf_stack_pop(&s) == NULL);
+
+    // pop_all 保留标签: 取空后压回同一节点，旧快照同样不能成功
+    aw_lf_stack_push(&s, &a);
+    old = aw_load_acq(&s.head);
+    AW_TEST_CHECK(aw_lf_stack_pop_all(&s) == &a);
+    aw_store_rlx(&a.next, NULL);
+    aw_lf_stack_push(&s, &a);
+    AW_TEST_CHECK(!aw_cas(&s.head, &old, _aw_lf_pack(old, NULL), AW_MO_ACQUIRE, AW_MO_ACQUIRE));
+}
+
+int main(void) {
+    int seen[NODES] = { 0 };
+    aw_lf_node_t* n;
+    int i, count = 0;
+
+    check_aba_replay();
+
+    for (i = 0; i < NODES; i++) {
+        aw_store_rlx(&nodes[i].held, 0);
+        aw_lf_stack_push(&stack, &nodes[i].link);
+    }
+
+    aw_test_run_threads(THREADS, worker);
+
+    // 结束时每个节点恰好在栈中出现一次: 既没有丢失也没有重复
+    for (n = aw_lf_stack_pop_all(&stack); n != NULL; n = (aw_lf_node_t*)aw_load_rlx(&n->next)) {
+        node_t* x = (node_t*)n;
+        AW_TEST_CHECK(x >= nodes && x < nodes + NODES);
+        AW_TEST_CHECK(seen[x - nodes]++ == 0);
+        AW_TEST_CHECK(aw_load_rlx(&x->held) == 0);
+        AW_TEST_CHECK(++count <= NODES);
+    }
+    AW_TEST_CHECK(count == NODES);
+    AW_TEST_CHECK(aw_lf_stack_empty(&stack));
+
+    AW_TEST_PASS("lf_stack");
+}
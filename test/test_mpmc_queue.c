@@ -0,0 +1,91 @@
+#include <sched.h>
+
+#include "aw_test.h"
+#include "aw_mpmc_queue.h"
+
+#define PRODUCERS 3
+#define CONSUMERS 3
+#define PER_PROD  50000ul
+#define CAPACITY  256
+
+// 元素大小不是字长倍数，覆盖单元格内的拷贝与对齐
+typedef struct {
+    unsigned long value;
+    unsigned char producer;
+    char          _odd[5];
+} rec_t;
+
+static size_t             storage[AW_MPMC_QUEUE_BUFFER_SIZE(CAPACITY, sizeof(rec_t)) / sizeof(size_t) + 1];
+static aw_mpmc_queue_t    queue;
+static aw_atomic_ulong_t  sum;
+static aw_atomic_ulong_t  seen[PRODUCERS];
+
+static void* producer(int p) {
+    unsigned long i;
+
+    for (i = 0; i < PER_PROD; i++) {
+        rec_t r;
+        r.value    = i;
+        r.producer = (unsigned char)p;
+        // 前一半用阻塞接口，后一半用 try 接口并在满时让出 CPU (单核机器上更快)
+        if (i < PER_PROD / 2) {
+            aw_mpmc_queue_enqueue(&queue, &r);
+        } else {
+            while (!aw_mpmc_queue_try_enqueue(&queue, &r)) {
+                sched_yield();
+            }
+        }
+    }
+    return NULL;
+}
+
+static void* consumer(void) {
+    unsigned long i;
+
+    for (i = 0; i < PER_PROD; i++) {
+        rec_t r;
+        while (!aw_mpmc_queue_try_dequeue(&queue, &r)) {
+            sched_yield();
+        }
+        AW_TEST_CHECK(r.producer < PRODUCERS && r.value < PER_PROD);
+        aw_faa_rlx(&sum, r.value);
+        aw_inc_rlx(&seen[r.producer]);
+    }
+    return NULL;
+}
+
+static void* run(void* arg) {
+    int id = (int)(intptr_t)arg;
+    return id < PRODUCERS ? producer(id) : consumer();
+}
+
+int main(void) {
+    rec_t r = { 7, 0, { 0 } };
+    size_t i;
+    int p;
+
+    AW_TEST_CHECK(!aw_mpmc_queue_init(&queue, storage, 100, sizeof(rec_t)));
+    AW_TEST_CHECK(aw_mpmc_queue_init(&queue, storage, CAPACITY, sizeof(rec_t)));
+    AW_TEST_CHECK(aw_mpmc_queue_capacity(&queue) == CAPACITY);
+
+    // 单线程边界
+    AW_TEST_CHECK(!aw_mpmc_queue_try_dequeue(&queue, &r));
+    for (i = 0; i < CAPACITY; i++) {
+        AW_TEST_CHECK(aw_mpmc_queue_try_enqueue(&queue, &r));
+    }
+    AW_TEST_CHECK(!aw_mpmc_queue_try_enqueue(&queue, &r));
+    for (i = 0; i < CAPACITY; i++) {
+        AW_TEST_CHECK(aw_mpmc_queue_try_dequeue(&queue, &r) && r.value == 7);
+    }
+
+    aw_test_run_threads(PRODUCERS + CONSUMERS, run);
+
+    // 每个值恰好出队一次: 计数与求和都必须吻合
+    AW_TEST_CHECK(aw_load_rlx(&sum) == PRODUCERS * (PER_PROD * (PER_PROD - 1) / 2));
+    for (p = 0; p < PRODUCERS; p++) {
+        AW_TEST_CHECK(aw_load_rlx(&seen[p]) == PER_PROD);
+    }
+    AW_TEST_CHECK(!aw_mpmc_queue_try_dequeue(&queue, &r));
+
+    AW_TEST_PASS("mpmc_queue");
+}
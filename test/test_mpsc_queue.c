@@ -0,0 +1,80 @@
+#include "aw_test.h"
+#include "aw_mpsc_queue.h"
+
+#define PRODUCERS 3
+#define PER_PROD  100000ul
+
+typedef struct {
+    aw_mpsc_node_t node;
+    unsigned long  value;
+    int            producer;
+} msg_t;
+
+static aw_mpsc_queue_t queue;
+
+static msg_t* msg_new(int p, unsigned long v) {
+    msg_t* m = (msg_t*)malloc(sizeof(msg_t));
+    AW_TEST_CHECK(m != NULL);
+    m->value    = v;
+    m->producer = p;
+    return m;
+}
+
+// 每三个值中的第一个以预先链接的三元素链批量入队，其余单个入队
+static void* producer(void* arg) {
+    int p = (int)(intptr_t)arg;
+    unsigned long i = 0;
+
+    while (i < PER_PROD) {
+        if (i % 3 == 0 && i + 3 <= PER_PROD) {
+            msg_t* a = msg_new(p, i);
+            msg_t* b = msg_new(p, i + 1);
+            msg_t* c = msg_new(p, i + 2);
+            aw_mpsc_node_link(&a->node, &b->node);
+            aw_mpsc_node_link(&b->node, &c->node);
+            aw_mpsc_queue_push_batch(&queue, &a->node, &c->node);
+            i += 3;
+        } else {
+            aw_mpsc_queue_push(&queue, &msg_new(p, i)->node);
+            i++;
+        }
+    }
+    return NULL;
+}
+
+int main(void) {
+    pthread_t tid[PRODUCERS];
+    unsigned long next[PRODUCERS] = { 0 };
+    unsigned long got = 0;
+    intptr_t p;
+
+    aw_mpsc_queue_init(&queue);
+    AW_TEST_CHECK(aw_mpsc_queue_empty(&queue));
+    AW_TEST_CHECK(aw_mpsc_queue_pop(&queue) == NULL);
+
+    for (p = 0; p < PRODUCERS; p++) {
+        AW_TEST_CHECK(pthread_create(&tid[p], NULL, producer, (void*)p) == 0);
+    }
+    // 主线程作为唯一消费者: 每个生产者的消息必须按入队顺序到达
+    while (got < PRODUCERS * PER_PROD) {
+        aw_mpsc_node_t* n = aw_mpsc_queue_pop(&queue);
+        msg_t* m;
+
+        if (n == NULL) {
+            continue;
+        }
+        m = AW_CONTAINER_OF(n, msg_t, node);
+        AW_TEST_CHECK(m->value == next[m->producer]);
+        next[m->producer]++;
+        got++;
+        free(m);
+    }
+    for (p = 0; p < PRODUCERS; p++) {
+        AW_TEST_CHECK(pthread_join(tid[p], NULL) == 0);
+    }
+
+    AW_TEST_CHECK(aw_mpsc_queue_pop(&queue) == NULL);
+    AW_TEST_CHECK(aw_mpsc_queue_empty(&queue));
+
+    AW_TEST_PASS("mpsc_queue");
+}
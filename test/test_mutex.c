@@ -0,0 +1,85 @@
+#include <time.h>
+
+#include "aw_test.h"
+#include "aw_mutex.h"
+
+#define THREADS 4
+#define ITERS   50000
+
+static aw_mutex_t mutex = AW_MUTEX_INIT;
+static long       counter;          // 仅在锁内访问
+static aw_atomic_int_t parked_done;
+
+static void sleep_ms(long ms) {
+    struct timespec ts;
+    ts.tv_sec  = ms / 1000;
+    ts.tv_nsec = (ms % 1000) * 1000000L;
+    nanosleep(&ts, NULL);
+}
+
+// 偶尔在锁内停留较久，让等待者经历 "自旋 -> 挂起 -> 唤醒" 路径
+static void* worker(void* arg) {
+    int i;
+
+    (void)arg;
+    for (i = 0; i < ITERS; i++) {
+        aw_mutex_lock(&mutex);
+        counter++;
+        if (i % 5000 == 0) {
+            sleep_ms(1);
+        }
+        aw_mutex_unlock(&mutex);
+    }
+    return NULL;
+}
+
+static void* blocked_locker(void* arg) {
+    (void)arg;
+    aw_mutex_lock(&mutex);
+    aw_mutex_unlock(&mutex);
+    aw_store_rel(&parked_done, 1);
+    return NULL;
+}
+
+int main(void) {
+    pthread_t tid;
+    int est;
+
+    aw_test_run_threads(THREADS, worker);
+    AW_TEST_CHECK(counter == (long)THREADS * ITERS);
+    AW_TEST_CHECK(aw_load_rlx(&mutex.state) == 0);
+
+    AW_TEST_CHECK(aw_mutex_try_lock(&mutex));
+    AW_TEST_CHECK(!aw_mutex_try_lock(&mutex));
+    aw_mutex_unlock(&mutex);
+
+    // 持有时间远超自旋上限: 等待者自旋失败后挂起，自旋估计值必须衰减
+    aw_store_rlx(&mutex.spin_est, AW_MUTEX_SPIN_MAX);
+    aw_mutex_lock(&mutex);
+    AW_TEST_CHECK(pthread_create(&tid, NULL, blocked_locker, NULL) == 0);
+    sleep_ms(50);
+    AW_TEST_CHECK(aw_load_acq(&parked_done) == 0);
+    est = aw_load_rlx(&mutex.spin_est);
+    AW_TEST_CHECK(est < AW_MUTEX_SPIN_MAX);
+    AW_TEST_CHECK(aw_load_rlx(&mutex.state) == 2);
+    aw_mutex_unlock(&mutex);
+    AW_TEST_CHECK(pthread_join(tid, NULL) == 0);
+    AW_TEST_CHECK(aw_load_acq(&parked_done) == 1);
+
+    // 反复挂起后估计值收缩到 0 (自旋上限回到最小值)
+    aw_store_rlx(&mutex.spin_est, AW_MUTEX_SPIN_MAX);
+    while (aw_load_rlx(&mutex.spin_est) > 0) {
+        int before = aw_load_rlx(&mutex.spin_est);
+        aw_store_rlx(&parked_done, 0);
+        aw_mutex_lock(&mutex);
+        AW_TEST_CHECK(pthread_create(&tid, NULL, blocked_locker, NULL) == 0);
+        while (aw_load_rlx(&mutex.state) != 2) {
+            sleep_ms(1);
+        }
+        aw_mutex_unlock(&mutex);
+        AW_TEST_CHECK(pthread_join(tid, NULL) == 0);
+        AW_TEST_CHECK(aw_load_rlx(&mutex.spin_est) < before);
+    }
+
+    AW_TEST_PASS("mutex");
+}
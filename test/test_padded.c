@@ -0,0 +1,73 @@
+#include <stddef.h>
+
+#include "aw_test.h"
+#include "aw_atomic_simple.h"
+#include "aw_mcslock.h"
+#include "aw_spsc_ring.h"
+#include "aw_mpmc_queue.h"
+#include "aw_mpsc_queue.h"
+#include "aw_hazard.h"
+#include "aw_epoch.h"
+
+#define THREADS 4
+#define ITERS   200000
+
+// 两个字段是否落在不同的缓存行 (结构体本身按缓存行对齐)
+#define SEPARATE_LINES(type, a, b) \
+    (offsetof(type, a) / AW_CACHELINE_SIZE != offsetof(type, b) / AW_CACHELINE_SIZE)
+
+#define CHECK_PADDED(type) \
+    AW_TEST_CHECK(sizeof(type) == AW_CACHELINE_SIZE && (AW_CACHELINE_SIZE & (AW_CACHELINE_SIZE - 1)) == 0)
+
+// 相邻的填充计数器: 每个线程只写自己的那一个
+static aw_padded_atomic_ulong_t slots[THREADS];
+
+static void* worker(void* arg) {
+    int id = (int)(intptr_t)arg;
+    int i;
+
+    for (i = 0; i < ITERS; i++) {
+        aw_inc_rlx(&slots[id].value);
+    }
+    return NULL;
+}
+
+int main(void) {
+    aw_padded_atomic_int_t local[2];
+    int i;
+
+    CHECK_PADDED(aw_padded_atomic_uchar_t);
+    CHECK_PADDED(aw_padded_atomic_ushort_t);
+    CHECK_PADDED(aw_padded_atomic_int_t);
+    CHECK_PADDED(aw_padded_atomic_uint_t);
+    CHECK_PADDED(aw_padded_atomic_long_t);
+    CHECK_PADDED(aw_padded_atomic_ulong_t);
+    CHECK_PADDED(aw_padded_atomic_llong_t);
+    CHECK_PADDED(aw_padded_atomic_ullong_t);
+    CHECK_PADDED(aw_padded_atomic_ptr_t);
+    CHECK_PADDED(aw_padded_atomic_size_t);
+
+    // 静态与栈上对象都按缓存行对齐
+    for (i = 0; i < THREADS; i++) {
+        AW_TEST_CHECK((uintptr_t)&slots[i] % AW_CACHELINE_SIZE == 0);
+    }
+    AW_TEST_CHECK((uintptr_t)&local[0] % AW_CACHELINE_SIZE == 0);
+    AW_TEST_CHECK((uintptr_t)&local[1] - (uintptr_t)&local[0] == AW_CACHELINE_SIZE);
+
+    // 各结构中由不同线程写入的字段位于不同缓存行
+    AW_TEST_CHECK(sizeof(aw_mcs_node_t) == AW_CACHELINE_SIZE);
+    AW_TEST_CHECK(SEPARATE_LINES(aw_spsc_ring_t, tail, head));
+    AW_TEST_CHECK(SEPARATE_LINES(aw_spsc_ring_t, buf, tail));
+    AW_TEST_CHECK(SEPARATE_LINES(aw_mpmc_queue_t, enqueue_pos, dequeue_pos));
+    AW_TEST_CHECK(SEPARATE_LINES(aw_mpsc_queue_t, tail, head));
+    AW_TEST_CHECK(sizeof(aw_hazard_rec_t) % AW_CACHELINE_SIZE == 0);
+    AW_TEST_CHECK(sizeof(aw_epoch_rec_t) % AW_CACHELINE_SIZE == 0);
+    AW_TEST_CHECK(SEPARATE_LINES(aw_epoch_domain_t, epoch, recs));
+
+    aw_test_run_threads(THREADS, worker);
+    for (i = 0; i < THREADS; i++) {
+        AW_TEST_CHECK(aw_load_rlx(&slots[i].value) == ITERS);
+    }
+
+    AW_TEST_PASS("padded");
+}
@@ -0,0 +1,127 @@
+#include <string.h>
+
+#include "aw_test.h"
+#include "aw_pool.h"
+
+#define THREADS 4
+#define BLOCKS  (THREADS * 8 * AW_POOL_BATCH)
+#define HELD    40              // 每个线程同时持有的块数，超过一批以触发补充与归还
+
+typedef struct {
+    int  owner;
+    long seq;
+    char payload[40];
+} msg_t;
+
+static aw_pool_t pool;
+static msg_t     slab[BLOCKS];  // sizeof(msg_t) 已是指针大小的整数倍，块与数组元素一一对应
+
+static int block_index(void* p) {
+    long off = (long)((char*)p - (char*)slab);
+
+    AW_TEST_CHECK(off >= 0 && off % (long)sizeof(msg_t) == 0 && off / (long)sizeof(msg_t) < BLOCKS);
+    return (int)(off / (long)sizeof(msg_t));
+}
+
+static void* worker(void* arg) {
+    int id = (int)(intptr_t)arg;
+    aw_pool_cache_t cache;
+    msg_t* held[HELD];
+    int i, round;
+
+    aw_pool_cache_init(&cache, &pool);
+    for (round = 0; round < aw_test_iters(2000, 500); round++) {
+        for (i = 0; i < HELD; i++) {
+            held[i] = (msg_t*)aw_pool_alloc(&cache);
+            AW_TEST_CHECK(held[i] != NULL);
+            held[i]->owner = id;
+            held[i]->seq   = round;
+        }
+        for (i = 0; i < HELD; i++) {
+            // 同一块不会同时分配给两个线程
+            AW_TEST_CHECK(held[i]->owner == id && held[i]->seq == round);
+            if (i == 0 && round % 8 == 0) {
+                aw_pool_free_remote(&pool, held[i]);
+            } else {
+                aw_pool_free(&cache, held[i]);
+            }
+        }
+    }
+    aw_pool_cache_flush(&cache);
+    return NULL;
+}
+
+int main(void) {
+    static unsigned char seen[BLOCKS];
+    aw_pool_cache_t cache;
+    aw_pool_stats_t st;
+    void* remote[3 * AW_POOL_BATCH];
+    unsigned long long refills, drains;
+    void* p;
+    int i, n;
+
+    aw_pool_init(&pool, sizeof(msg_t));
+    AW_TEST_CHECK(pool.block_size == sizeof(msg_t));
+    AW_TEST_CHECK(aw_pool_add_slab(&pool, slab, sizeof(slab)) == BLOCKS);
+
+    // 单线程: 取空整个池，每个块恰好出现一次
+    aw_pool_cache_init(&cache, &pool);
+    for (n = 0; (p = aw_pool_alloc(&cache)) != NULL; n++) {
+        i = block_index(p);
+        AW_TEST_CHECK(!seen[i]);
+        seen[i] = 1;
+    }
+    AW_TEST_CHECK(n == BLOCKS);
+
+    // 每批第一个块来自补充，其余为命中; 未汇总的命中不足一批
+    aw_pool_get_stats(&pool, &st);
+    AW_TEST_CHECK(st.refills == BLOCKS / AW_POOL_BATCH);
+    AW_TEST_CHECK(st.hits + cache.hits == BLOCKS - BLOCKS / AW_POOL_BATCH);
+    AW_TEST_CHECK(cache.hits < AW_POOL_BATCH);
+
+    for (i = 0; i < BLOCKS; i++) {
+        aw_pool_free(&cache, &slab[i]);
+    }
+    AW_TEST_CHECK(cache.count <= 2 * AW_POOL_BATCH);
+    aw_pool_cache_flush(&cache);
+    aw_pool_get_stats(&pool, &st);
+    AW_TEST_CHECK(st.drains > 0 && st.remote_frees == 0);
+
+    // 远程释放的块由一次补充整体取回，超出两批的部分按批交还
+    for (i = 0; i < 3 * AW_POOL_BATCH; i++) {
+        remote[i] = aw_pool_alloc(&cache);
+        AW_TEST_CHECK(remote[i] != NULL);
+    }
+    aw_pool_cache_flush(&cache);
+    aw_pool_get_stats(&pool, &st);
+    refills = st.refills;
+    drains  = st.drains;
+    for (i = 0; i < 3 * AW_POOL_BATCH; i++) {
+        aw_pool_free_remote(&pool, remote[i]);
+    }
+    // 最近释放的块留在本地缓存的头部
+    p = aw_pool_alloc(&cache);
+    AW_TEST_CHECK(p == remote[3 * AW_POOL_BATCH - 1]);
+    aw_pool_get_stats(&pool, &st);
+    AW_TEST_CHECK(st.refills == refills + 1 && st.drains == drains + 1);
+    AW_TEST_CHECK(cache.count == 2 * AW_POOL_BATCH - 1 && aw_lf_stack_empty(&pool.remote));
+    aw_pool_free(&cache, p);
+    aw_pool_cache_flush(&cache);
+
+    // 多线程分配 / 释放 / 远程释放
+    aw_test_run_threads(THREADS, worker);
+    aw_pool_get_stats(&pool, &st);
+    AW_TEST_CHECK(st.remote_frees > 3 * AW_POOL_BATCH);
+
+    // 全部交还后块数不增不减
+    memset(seen, 0, sizeof(seen));
+    aw_pool_cache_init(&cache, &pool);
+    for (n = 0; (p = aw_pool_alloc(&cache)) != NULL; n++) {
+        i = block_index(p);
+        AW_TEST_CHECK(!seen[i]);
+        seen[i] = 1;
+    }
+    AW_TEST_CHECK(n == BLOCKS);
+
+    AW_TEST_PASS("pool");
+}
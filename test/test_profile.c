@@ -0,0 +1,84 @@
+#define AW_ATOMIC_PROFILE
+
+#include <sched.h>
+#include <string.h>
+
+#include "aw_test.h"
+#include "aw_ticketlock.h"
+#include "aw_seqlock.h"
+
+static aw_ticketlock_t lock = AW_TICKETLOCK_INIT;
+static aw_seqlock_t    seq  = AW_SEQLOCK_INIT;
+static aw_atomic_int_t waiter_done;
+
+static void* lock_waiter(void* arg) {
+    (void)arg;
+    aw_ticketlock_lock(&lock);
+    aw_ticketlock_unlock(&lock);
+    aw_store_rel(&waiter_done, 1);
+    return NULL;
+}
+
+static void* seq_reader(void* arg) {
+    (void)arg;
+    aw_seqlock_read_begin(&seq);
+    aw_store_rel(&waiter_done, 1);
+    return NULL;
+}
+
+// 主线程持有期间另一线程必然在 pause 循环中等待，让出足够多次后由调用方释放
+static pthread_t start_waiter(void* (*waiter)(void*)) {
+    pthread_t tid;
+    int i;
+
+    aw_store_rlx(&waiter_done, 0);
+    AW_TEST_CHECK(pthread_create(&tid, NULL, waiter, NULL) == 0);
+    for (i = 0; i < 1000; i++) {
+        sched_yield();
+    }
+    AW_TEST_CHECK(aw_load_acq(&waiter_done) == 0);
+    return tid;
+}
+
+// 累加 file 中所有调用点的统计
+static void sum_file(const aw_profile_site_t* s, size_t n, const char* file,
+                     unsigned long long* spins, unsigned long long* pauses) {
+    size_t i;
+
+    *spins = *pauses = 0;
+    for (i = 0; i < n; i++) {
+        if (strstr(s[i].file, file) != NULL) {
+            *spins  += s[i].spins;
+            *pauses += s[i].pauses;
+        }
+    }
+}
+
+int main(void) {
+    aw_profile_site_t* sites;
+    size_t n;
+    unsigned long long spins, pauses;
+    pthread_t tid;
+
+    aw_seqlock_write_begin(&seq);
+    tid = start_waiter(seq_reader);
+    aw_seqlock_write_end(&seq);
+    AW_TEST_CHECK(pthread_join(tid, NULL) == 0);
+
+    aw_ticketlock_lock(&lock);
+    tid = start_waiter(lock_waiter);
+    aw_ticketlock_unlock(&lock);
+    AW_TEST_CHECK(pthread_join(tid, NULL) == 0);
+
+    sites = aw_profile_collect(&n, NULL);
+    AW_TEST_CHECK(sites != NULL);
+    // 每轮等待一次 pause
+    sum_file(sites, n, "aw_seqlock.h", &spins, &pauses);
+    AW_TEST_CHECK(spins > 0 && pauses == spins);
+    // 每轮按排队距离 pause 多次
+    sum_file(sites, n, "aw_ticketlock.h", &spins, &pauses);
+    AW_TEST_CHECK(spins > 0 && pauses >= spins);
+    free(sites);
+
+    AW_TEST_PASS("profile");
+}
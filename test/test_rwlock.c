@@ -0,0 +1,80 @@
+#include "aw_test.h"
+#include "aw_rwlock.h"
+
+#define READERS 3
+#define WRITERS 2
+#define ITERS   20000
+
+static aw_rwlock_t lock = AW_RWLOCK_INIT;
+
+// 写者在锁内把两个字段改成相同的新值，读者在锁内看到的两者必须一致
+static aw_atomic_long_t field_a;
+static aw_atomic_long_t field_b;
+static aw_atomic_int_t  in_write;       // 写临界区内的线程数
+static aw_atomic_int_t  in_read;        // 读临界区内的线程数
+
+static void* writer(void) {
+    int i;
+
+    for (i = 0; i < ITERS; i++) {
+        long v;
+
+        aw_rwlock_write_lock(&lock);
+        AW_TEST_CHECK(aw_faa_rlx(&in_write, 1) == 0);
+        AW_TEST_CHECK(aw_load_rlx(&in_read) == 0);
+        v = aw_load_rlx(&field_a) + 1;
+        aw_store_rlx(&field_a, v);
+        aw_store_rlx(&field_b, v);
+        aw_fas_rlx(&in_write, 1);
+        aw_rwlock_write_unlock(&lock);
+    }
+    return NULL;
+}
+
+static void* reader(void) {
+    int i;
+
+    for (i = 0; i < ITERS * 4; i++) {
+        int slot = aw_rwlock_read_lock(&lock);
+
+        AW_TEST_CHECK(slot >= 0 && slot < AW_RWLOCK_SLOTS);
+        aw_inc_rlx(&in_read);
+        AW_TEST_CHECK(aw_load_rlx(&in_write) == 0);
+        AW_TEST_CHECK(aw_load_rlx(&field_a) == aw_load_rlx(&field_b));
+        aw_fas_rlx(&in_read, 1);
+        aw_rwlock_read_unlock(&lock, slot);
+    }
+    return NULL;
+}
+
+static void* run(void* arg) {
+    return (intptr_t)arg < WRITERS ? writer() : reader();
+}
+
+int main(void) {
+    int slot, i;
+
+    // 读者之间共享，写者与读者互斥
+    slot = aw_rwlock_try_read_lock(&lock);
+    AW_TEST_CHECK(slot >= 0);
+    i = aw_rwlock_read_lock(&lock);
+    AW_TEST_CHECK(!aw_rwlock_try_write_lock(&lock));
+    aw_rwlock_read_unlock(&lock, i);
+    aw_rwlock_read_unlock(&lock, slot);
+
+    AW_TEST_CHECK(aw_rwlock_try_write_lock(&lock));
+    AW_TEST_CHECK(aw_rwlock_try_read_lock(&lock) < 0);
+    AW_TEST_CHECK(!aw_rwlock_try_write_lock(&lock));
+    aw_rwlock_write_unlock(&lock);
+
+    aw_test_run_threads(READERS + WRITERS, run);
+    AW_TEST_CHECK(aw_load_rlx(&field_a) == (long)WRITERS * ITERS);
+
+    // 结束后所有槽位归零
+    for (i = 0; i < AW_RWLOCK_SLOTS; i++) {
+        AW_TEST_CHECK(aw_load_rlx(&lock.readers[i].value) == 0);
+    }
+    AW_TEST_CHECK(aw_load_rlx(&lock.writer.value) == 0);
+
+    AW_TEST_PASS("rwlock");
+}
@@ -0,0 +1,100 @@
+#include <sched.h>
+
+#include "aw_test.h"
+#include "aw_seqlock.h"
+
+#define WRITERS 2
+#define READERS 2
+#define WRITES  20000
+
+// 大小不是机器字的整数倍，拷贝时同时经过逐字与逐字节路径
+typedef struct {
+    unsigned long a;
+    unsigned long b;
+    unsigned char tail[11];
+} snap_t;
+
+static aw_seqlock_t    sl = AW_SEQLOCK_INIT;
+static snap_t          shared;
+static aw_atomic_int_t writers_left = AW_ATOMIC_VAR_INIT(WRITERS);
+static aw_atomic_long_t snapshots;
+
+static void fill(snap_t* s, unsigned long v) {
+    int i;
+
+    s->a = v;
+    s->b = ~v;
+    for (i = 0; i < (int)sizeof(s->tail); i++) {
+        s->tail[i] = (unsigned char)(v + (unsigned long)i);
+    }
+}
+
+static void check(const snap_t* s) {
+    int i;
+
+    AW_TEST_CHECK(s->b == ~s->a);
+    for (i = 0; i < (int)sizeof(s->tail); i++) {
+        AW_TEST_CHECK(s->tail[i] == (unsigned char)(s->a + (unsigned long)i));
+    }
+}
+
+static void* writer(void* arg) {
+    unsigned long id = (unsigned long)(intptr_t)arg;
+    snap_t s;
+    int i;
+
+    for (i = 1; i <= WRITES; i++) {
+        fill(&s, id * WRITES + (unsigned long)i);
+        aw_seqlock_write(&sl, &shared, &s, sizeof(s));
+        if (i % 64 == 0) {
+            sched_yield();
+        }
+    }
+    aw_dec_ar(&writers_left);
+    return NULL;
+}
+
+static void* reader(void* arg) {
+    snap_t s;
+
+    (void)arg;
+    do {
+        aw_seqlock_read(&sl, &s, &shared, sizeof(s));
+        check(&s);
+        aw_inc_rlx(&snapshots);
+    } while (aw_load_acq(&writers_left) != 0);
+    return NULL;
+}
+
+static void* worker(void* arg) {
+    int id = (int)(intptr_t)arg;
+
+    return id < WRITERS ? writer(arg) : reader(arg);
+}
+
+int main(void) {
+    snap_t s;
+    unsigned int start;
+
+    fill(&s, 0);
+    aw_seqlock_write(&sl, &shared, &s, sizeof(s));
+
+    // 读取期间发生写入时必须重试
+    start = aw_seqlock_read_begin(&sl);
+    AW_TEST_CHECK((start & 1u) == 0);
+    AW_TEST_CHECK(!aw_seqlock_read_retry(&sl, start));
+    aw_seqlock_write_begin(&sl);
+    aw_seqlock_write_end(&sl);
+    AW_TEST_CHECK(aw_seqlock_read_retry(&sl, start));
+
+    aw_test_run_threads(WRITERS + READERS, worker);
+    AW_TEST_CHECK(aw_load_rlx(&snapshots) >= READERS);
+
+    // 最后一次写入的序列号仍为偶数，快照完整
+    aw_seqlock_read(&sl, &s, &shared, sizeof(s));
+    check(&s);
+    AW_TEST_CHECK(s.a % WRITES == 0);
+    AW_TEST_CHECK((aw_load_rlx(&sl.seq) & 1u) == 0);
+
+    AW_TEST_PASS("seqlock");
+}
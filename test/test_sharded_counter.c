@@ -0,0 +1,51 @@
+#include "aw_test.h"
+#include "aw_sharded_counter.h"
+
+#define THREADS 8
+#define ITERS   100000
+
+static aw_sharded_counter_t counter;
+static aw_atomic_uint_t     hints[THREADS];
+
+static void* worker(void* arg) {
+    int id = (int)(intptr_t)arg;
+    int i;
+
+    // 同一线程的提示编号固定不变
+    aw_store_rlx(&hints[id], aw_thread_hint());
+    for (i = 0; i < ITERS; i++) {
+        aw_sharded_inc_rlx(&counter);
+        if (i % 4 == 0) {
+            aw_sharded_faa_rlx(&counter, 3);
+            aw_sharded_dec_rlx(&counter);
+        }
+    }
+    AW_TEST_CHECK(aw_load_rlx(&hints[id]) == aw_thread_hint());
+    return NULL;
+}
+
+int main(void) {
+    int i, j;
+
+    AW_TEST_CHECK(sizeof(aw_sharded_cell_t) == AW_CACHELINE_SIZE);
+    AW_TEST_CHECK(((uintptr_t)&counter.cells[1] - (uintptr_t)&counter.cells[0]) == AW_CACHELINE_SIZE);
+
+    aw_sharded_counter_init(&counter);
+    AW_TEST_CHECK(aw_sharded_load_rlx(&counter) == 0);
+
+    aw_test_run_threads(THREADS, worker);
+    AW_TEST_CHECK(aw_sharded_load_rlx(&counter) ==
+                  (unsigned long long)THREADS * (ITERS + 2 * (ITERS / 4)));
+
+    // 线程数不超过分片数时，各线程的提示编号互不相同，写入落在不同分片
+    for (i = 0; i < THREADS; i++) {
+        for (j = i + 1; j < THREADS; j++) {
+            AW_TEST_CHECK(aw_load_rlx(&hints[i]) != aw_load_rlx(&hints[j]));
+        }
+    }
+
+    aw_sharded_reset(&counter);
+    AW_TEST_CHECK(aw_sharded_load_rlx(&counter) == 0);
+
+    AW_TEST_PASS("sharded_counter");
+}
@@ -0,0 +1,43 @@
+#include "aw_test.h"
+#include "aw_spinlock.h"
+
+#define THREADS 4
+#define ITERS   100000
+
+static aw_spinlock_t lock = AW_SPINLOCK_INIT;
+static long counter;                // 仅在锁内访问
+
+static void* worker(void* arg) {
+    int i;
+
+    (void)arg;
+    for (i = 0; i < ITERS; i++) {
+        aw_spinlock_lock(&lock);
+        counter++;
+        aw_spinlock_unlock(&lock);
+    }
+    return NULL;
+}
+
+int main(void) {
+    aw_backoff_t bo = AW_BACKOFF_INIT;
+    int i;
+
+    // 退避翻倍直到上限
+    for (i = 0; i < 32; i++) {
+        aw_backoff_spin(&bo);
+    }
+    AW_TEST_CHECK(aw_backoff_saturated(&bo));
+    AW_TEST_CHECK(bo.spins == AW_BACKOFF_MAX_SPINS);
+
+    aw_test_run_threads(THREADS, worker);
+    AW_TEST_CHECK(counter == (long)THREADS * ITERS);
+
+    AW_TEST_CHECK(!aw_spinlock_is_locked(&lock));
+    AW_TEST_CHECK(aw_spinlock_try_lock(&lock));
+    AW_TEST_CHECK(!aw_spinlock_try_lock(&lock));
+    aw_spinlock_unlock(&lock);
+    AW_TEST_CHECK(!aw_spinlock_is_locked(&lock));
+
+    AW_TEST_PASS("spinlock");
+}
@@ -0,0 +1,88 @@
+#include <sched.h>
+
+#include "aw_test.h"
+#include "aw_spsc_ring.h"
+
+#define CAPACITY 256
+#define COUNT    300000ul
+
+static unsigned long  storage[CAPACITY];
+static aw_spsc_ring_t ring;
+
+// 生产者交替使用单个与批量写入，批量大小与消费者不同以覆盖环绕拷贝
+static void* producer(void* arg) {
+    unsigned long next = 0;
+
+    (void)arg;
+    while (next < COUNT) {
+        unsigned long batch[5];
+        size_t n = COUNT - next < 5 ? (size_t)(COUNT - next) : 5;
+        size_t k;
+
+        if (next % 2 == 0) {
+            k = aw_spsc_ring_push(&ring, &next) ? 1 : 0;
+        } else {
+            for (k = 0; k < n; k++) {
+                batch[k] = next + k;
+            }
+            k = aw_spsc_ring_push_n(&ring, batch, n);
+        }
+        // 队列满时让出 CPU，单核机器上消费者才能运行
+        if (k == 0) {
+            sched_yield();
+        }
+        next += k;
+    }
+    return NULL;
+}
+
+// 消费者按序检查，任何丢失、重复或乱序都会失败
+static void* consumer(void* arg) {
+    unsigned long expect = 0;
+
+    (void)arg;
+    while (expect < COUNT) {
+        unsigned long batch[7];
+        size_t n = aw_spsc_ring_pop_n(&ring, batch, 7);
+        size_t k;
+
+        if (n == 0) {
+            sched_yield();
+        }
+        for (k = 0; k < n; k++) {
+            AW_TEST_CHECK(batch[k] == expect);
+            expect++;
+        }
+    }
+    return NULL;
+}
+
+static void* run(void* arg) {
+    return (intptr_t)arg == 0 ? producer(arg) : consumer(arg);
+}
+
+int main(void) {
+    unsigned long v = 42, out = 0;
+    size_t i;
+
+    AW_TEST_CHECK(!aw_spsc_ring_init(&ring, storage, 100, sizeof(unsigned long)));
+    AW_TEST_CHECK(aw_spsc_ring_init(&ring, storage, CAPACITY, sizeof(unsigned long)));
+    AW_TEST_CHECK(aw_spsc_ring_capacity(&ring) == CAPACITY);
+
+    // 单线程边界: 空时 pop 失败，满时 push 失败
+    AW_TEST_CHECK(!aw_spsc_ring_pop(&ring, &out));
+    for (i = 0; i < CAPACITY; i++) {
+        AW_TEST_CHECK(aw_spsc_ring_push(&ring, &v));
+    }
+    AW_TEST_CHECK(!aw_spsc_ring_push(&ring, &v));
+    AW_TEST_CHECK(aw_spsc_ring_size_approx(&ring) == CAPACITY);
+    for (i = 0; i < CAPACITY; i++) {
+        AW_TEST_CHECK(aw_spsc_ring_pop(&ring, &out) && out == 42);
+    }
+    AW_TEST_CHECK(!aw_spsc_ring_pop(&ring, &out));
+
+    aw_test_run_threads(2, run);
+    AW_TEST_CHECK(aw_spsc_ring_size_approx(&ring) == 0);
+
+    AW_TEST_PASS("spsc_ring");
+}
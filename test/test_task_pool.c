@@ -0,0 +1,85 @@
+#include <sched.h>
+
+#include "aw_test.h"
+#include "aw_task_pool.h"
+
+#define WORKERS 3
+#define DEPTH   12              // 递归 fork/join 树的深度，叶子数为 2^DEPTH
+#define FLAT    1000            // 从外部直接投递的独立任务数
+
+typedef struct {
+    aw_task_t         task;
+    int               depth;
+    aw_atomic_long_t* parent_pending;
+} node_t;
+
+static aw_task_pool_t   pool;
+static aw_task_worker_t workers[WORKERS];
+static aw_atomic_long_t leaves;
+static aw_atomic_long_t root_pending;
+
+static void node_run(aw_task_t* t, aw_task_worker_t* w) {
+    node_t* n = AW_CONTAINER_OF(t, node_t, task);
+
+    if (n->depth == 0) {
+        aw_inc_rlx(&leaves);
+    } else {
+        // 子任务放在本栈帧中: join 返回前本帧一直有效，窃取者可以安全访问
+        aw_atomic_long_t pending;
+        node_t kids[2];
+        int k;
+
+        aw_store_rlx(&pending, 2L);
+        for (k = 0; k < 2; k++) {
+            kids[k].task.run       = node_run;
+            kids[k].depth          = n->depth - 1;
+            kids[k].parent_pending = &pending;
+            aw_task_spawn(w, &kids[k].task);
+        }
+        aw_task_join(w, &pending);
+    }
+    aw_dec_ar(n->parent_pending);
+}
+
+static void* worker(void* arg) {
+    aw_task_worker_run(&workers[(int)(intptr_t)arg]);
+    return NULL;
+}
+
+int main(void) {
+    static node_t flat[FLAT];
+    pthread_t tid[WORKERS];
+    node_t root;
+    int i;
+
+    AW_TEST_CHECK(aw_task_pool_init(&pool, workers, WORKERS, 4));
+    for (i = 0; i < WORKERS; i++) {
+        AW_TEST_CHECK(pthread_create(&tid[i], NULL, worker, (void*)(intptr_t)i) == 0);
+    }
+
+    aw_store_rlx(&root_pending, 1L + FLAT);
+    root.task.run       = node_run;
+    root.depth          = DEPTH;
+    root.parent_pending = &root_pending;
+    aw_task_submit(&pool, &root.task);
+    for (i = 0; i < FLAT; i++) {
+        flat[i].task.run       = node_run;
+        flat[i].depth          = 0;
+        flat[i].parent_pending = &root_pending;
+        aw_task_submit(&pool, &flat[i].task);
+    }
+
+    while (aw_load_acq(&root_pending) != 0) {
+        sched_yield();
+    }
+    AW_TEST_CHECK(aw_load_rlx(&leaves) == (1L << DEPTH) + FLAT);
+
+    // 空闲工作者挂起后 stop 仍能把它们全部唤醒
+    aw_task_pool_stop(&pool);
+    for (i = 0; i < WORKERS; i++) {
+        AW_TEST_CHECK(pthread_join(tid[i], NULL) == 0);
+    }
+    aw_task_pool_destroy(&pool);
+
+    AW_TEST_PASS("task_pool");
+}
@@ -0,0 +1,52 @@
+#include "aw_test.h"
+#include "aw_ticketlock.h"
+#include "aw_mcslock.h"
+
+#define THREADS 3
+
+static int iters;           // 每线程迭代次数，见 aw_test_iters
+
+static aw_ticketlock_t tlock = AW_TICKETLOCK_INIT;
+static aw_mcslock_t    mlock = AW_MCSLOCK_INIT;
+static long ticket_counter;
+static long mcs_counter;
+
+static void* worker(void* arg) {
+    aw_mcs_node_t node;
+    int i;
+
+    (void)arg;
+    for (i = 0; i < iters; i++) {
+        aw_ticketlock_lock(&tlock);
+        ticket_counter++;
+        aw_ticketlock_unlock(&tlock);
+
+        aw_mcslock_lock(&mlock, &node);
+        mcs_counter++;
+        aw_mcslock_unlock(&mlock, &node);
+    }
+    return NULL;
+}
+
+int main(void) {
+    aw_mcs_node_t a, b;
+
+    iters = aw_test_iters(20000, 100);
+    aw_test_run_threads(THREADS, worker);
+    AW_TEST_CHECK(ticket_counter == (long)THREADS * iters);
+    AW_TEST_CHECK(mcs_counter == (long)THREADS * iters);
+
+    AW_TEST_CHECK(!aw_ticketlock_is_locked(&tlock));
+    AW_TEST_CHECK(aw_ticketlock_try_lock(&tlock));
+    AW_TEST_CHECK(!aw_ticketlock_try_lock(&tlock));
+    aw_ticketlock_unlock(&tlock);
+    AW_TEST_CHECK(!aw_ticketlock_is_locked(&tlock));
+
+    AW_TEST_CHECK(aw_mcslock_try_lock(&mlock, &a));
+    AW_TEST_CHECK(!aw_mcslock_try_lock(&mlock, &b));
+    aw_mcslock_unlock(&mlock, &a);
+    AW_TEST_CHECK(aw_mcslock_try_lock(&mlock, &b));
+    aw_mcslock_unlock(&mlock, &b);
+
+    AW_TEST_PASS("ticketlock/mcslock");
+}
@@ -0,0 +1,80 @@
+#include <sched.h>
+
+#include "aw_test.h"
+#include "aw_ws_deque.h"
+
+#define THIEVES 3
+#define ITEMS   200000
+
+static aw_ws_deque_t   q;
+static aw_atomic_int_t seen[ITEMS];
+static aw_atomic_int_t done;
+
+static void consume(void* x) {
+    long i = (long)(intptr_t)x - 1;
+
+    AW_TEST_CHECK(i >= 0 && i < ITEMS);
+    aw_inc_rlx(&seen[i]);
+}
+
+static void* thief(void* arg) {
+    (void)arg;
+    for (;;) {
+        void* x = aw_ws_deque_steal(&q);
+
+        if (x != NULL) {
+            consume(x);
+        } else if (aw_load_acq(&done)) {
+            break;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+int main(void) {
+    pthread_t tid[THIEVES];
+    void* x;
+    long i;
+
+    // 初始容量 4，迫使所有者在窃取者并发读取时多次扩容
+    AW_TEST_CHECK(aw_ws_deque_init(&q, 2));
+
+    // 单线程: 所有者 LIFO，窃取者 FIFO
+    for (i = 1; i <= 3; i++) {
+        AW_TEST_CHECK(aw_ws_deque_push(&q, (void*)(intptr_t)i));
+    }
+    AW_TEST_CHECK(aw_ws_deque_size(&q) == 3);
+    AW_TEST_CHECK(aw_ws_deque_take(&q) == (void*)(intptr_t)3);
+    AW_TEST_CHECK(aw_ws_deque_steal(&q) == (void*)(intptr_t)1);
+    AW_TEST_CHECK(aw_ws_deque_take(&q) == (void*)(intptr_t)2);
+    AW_TEST_CHECK(aw_ws_deque_take(&q) == NULL);
+    AW_TEST_CHECK(aw_ws_deque_steal(&q) == NULL);
+
+    // 并发: 所有者压入并间或取出，窃取者从顶部窃取，每个元素恰好被消费一次
+    for (i = 0; i < THIEVES; i++) {
+        AW_TEST_CHECK(pthread_create(&tid[i], NULL, thief, NULL) == 0);
+    }
+    for (i = 0; i < ITEMS; i++) {
+        AW_TEST_CHECK(aw_ws_deque_push(&q, (void*)(intptr_t)(i + 1)));
+        if (i % 3 == 0 && (x = aw_ws_deque_take(&q)) != NULL) {
+            consume(x);
+        }
+    }
+    while ((x = aw_ws_deque_take(&q)) != NULL) {
+        consume(x);
+    }
+    aw_store_rel(&done, 1);
+    for (i = 0; i < THIEVES; i++) {
+        AW_TEST_CHECK(pthread_join(tid[i], NULL) == 0);
+    }
+
+    for (i = 0; i < ITEMS; i++) {
+        AW_TEST_CHECK(aw_load_rlx(&seen[i]) == 1);
+    }
+    AW_TEST_CHECK(aw_ws_deque_size(&q) == 0);
+    aw_ws_deque_destroy(&q);
+
+    AW_TEST_PASS("ws_deque");
+}